@@ -9,6 +9,7 @@ extern "C" {
 ///////////// device control methods ////////////////////////
 int dxl_initialize( int devIndex, int baudnum );
 void dxl_terminate();
+void dxl_set_return_delay( int us );
 
 
 ///////////// set/get packet methods //////////////////////////
@@ -26,6 +27,7 @@ void dxl_set_txpacket_instruction(int instruction);
 #define INST_ACTION			(5)
 #define INST_RESET			(6)
 #define INST_SYNC_WRITE		(131)
+#define INST_BULK_READ		(146) // MX series only
 
 void dxl_set_txpacket_parameter(int index, int value);
 void dxl_set_txpacket_length(int length);
@@ -71,6 +73,62 @@ int dxl_read_byte(int id, int address);
 void dxl_write_byte(int id, int address, int value);
 int dxl_read_word(int id, int address);
 void dxl_write_word(int id, int address, int value);
+void dxl_sync_write_words(int address, int *ids, int *values, int num);
+#define MAXNUM_SYNC_WORDS	((MAXNUM_TXPARAM - 2) / 3)
+void dxl_sync_write_bytes(int address, int *ids, int *values, int num);
+#define MAXNUM_SYNC_BYTES	((MAXNUM_TXPARAM - 2) / 2)
+
+
+//////////// status return methods //////////////////////////
+void dxl_set_status_return(int id, int level);
+int dxl_get_status_return(int id);
+int dxl_reply_expected(int id, int instruction);
+#define STATUS_RETURN_NONE	(0) // ping only
+#define STATUS_RETURN_READ	(1) // ping and read
+#define STATUS_RETURN_ALL	(2)
+
+
+//////////// async methods //////////////////////////////////
+#define MAXNUM_ASYNC_QUEUE	(4)
+#define MAXNUM_ASYNC_PARAM	(16)
+#define MAXNUM_ASYNC_SYNC_WORDS	((MAXNUM_ASYNC_PARAM - 2) / 3)
+#define MAXNUM_ASYNC_BULK_READ	((MAXNUM_ASYNC_PARAM - 1) / 3)
+#define DXL_NO_REPLY		(255)
+
+struct dxl_bulk_entry
+{
+	unsigned char id;
+	unsigned char address;		// first control table address to read
+	unsigned char length;		// bytes to read, at most MAXNUM_ASYNC_PARAM
+	volatile unsigned char result;	// COMM_RXSUCCESS, or why the read failed
+	unsigned char *data;		// caller's buffer of 'length' bytes
+};
+
+struct dxl_transaction
+{
+	unsigned char id;
+	unsigned char instruction;
+	unsigned char num_param;	// parameters to send, then received
+	unsigned char param[MAXNUM_ASYNC_PARAM];
+	unsigned char reply;		// parameters in the status packet, or DXL_NO_REPLY
+	volatile unsigned char result;	// COMM_RXWAITING until the transaction is over
+	unsigned char error;		// ERRBIT_ bits of the status packet
+	void (*done)(struct dxl_transaction *t);	// called from the interrupt, or 0
+	struct dxl_bulk_entry *bulk;	// where an INST_BULK_READ stores each reply, or 0
+};
+int dxl_async_submit(struct dxl_transaction *t);
+int dxl_async_idle(void);
+int dxl_async_sync_write_words(struct dxl_transaction *t, int address, int *ids, int *values, int num);
+int dxl_async_bulk_read(struct dxl_transaction *t, struct dxl_bulk_entry *entries, int num);
+
+
+//////////// trace methods ////////////////////////////////////
+void dxl_set_trace_hook(void (*hook)(int event));
+#define DXL_TRACE_TX_START	(0)
+#define DXL_TRACE_TX_END	(1)
+#define DXL_TRACE_RX_START	(2)
+#define DXL_TRACE_RX_END	(3)
+#define DXL_TRACE_RX_TIMEOUT	(4)
 
 
 #ifdef __cplusplus
@@ -8,6 +8,10 @@ extern "C" {
 
 void serial_initialize(long ubrr);
 void serial_write( unsigned char *pData, int numbyte );
+int serial_try_write( unsigned char *pData, int numbyte );
+int serial_get_txfree(void);
+long serial_set_baudrate(long baudrate);
+void serial_flush(void);
 unsigned char serial_read( unsigned char *pData, int numbyte );
 int serial_get_qstate(void);
 
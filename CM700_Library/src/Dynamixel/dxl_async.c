@@ -0,0 +1,356 @@
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "dxl_hal.h"
+#include "dynamixel.h"
+
+// Transactions queued with dxl_async_submit go out one at a time. The USART0
+// and timer 3 interrupts move each one from transmit to status packet to
+// completion and start the next, so the caller can work meanwhile. An
+// INST_BULK_READ is one transaction that receives a status packet from each
+// servo in turn. Everything below dxl_async_submit runs in interrupt context.
+
+#define ID					(2)
+#define LENGTH				(3)
+#define INSTRUCTION			(4)
+#define ERRBIT				(4)
+#define PARAMETER			(5)
+
+extern int gbCommStatus;
+extern int giBusUsing;
+extern void (*gpTraceHook)(int event);
+
+#define DXL_TRACE(event)	if( gpTraceHook ) gpTraceHook(event)
+
+struct dxl_transaction *gpAsyncQueue[MAXNUM_ASYNC_QUEUE];
+volatile unsigned char gbAsyncHead = 0;
+volatile unsigned char gbAsyncCount = 0;
+volatile unsigned char gbAsyncActive = 0;
+unsigned char gbAsyncPacket[MAXNUM_ASYNC_PARAM+6];	// instruction, then status
+volatile unsigned char gbAsyncRxLength = 0;
+volatile unsigned char gbAsyncEntry = 0;	// bulk read entry being received
+
+void dxl_async_start(void);
+void dxl_async_timeout(void);
+
+// Number of entries of the bulk read 't'
+unsigned char dxl_async_bulk_count( struct dxl_transaction *t )
+{
+	return (t->num_param - 1) / 3;
+}
+
+// End the transaction at the head of the queue with 'result' and start the
+// next one.
+void dxl_async_finish( int result )
+{
+	struct dxl_transaction *t = gpAsyncQueue[gbAsyncHead];
+	unsigned char i;
+
+	dxl_hal_set_alarm( 0, 0 );
+	dxl_hal_set_rx_hook( 0 );
+	if( result == COMM_RXTIMEOUT )
+	{
+		DXL_TRACE( DXL_TRACE_RX_TIMEOUT );
+	}
+	else if( result != COMM_TXSUCCESS )
+	{
+		DXL_TRACE( DXL_TRACE_RX_END );
+	}
+
+	// Late bytes go to the buffer; have the next blocking packet clear it
+	if( result == COMM_RXTIMEOUT || result == COMM_RXCORRUPT )
+		gbCommStatus = result;
+
+	// The servos of a bulk read answer in order, so once one fails the rest
+	// are not waited for
+	if( t->bulk )
+		for( i=gbAsyncEntry; i<dxl_async_bulk_count( t ); i++ )
+			t->bulk[i].result = (unsigned char)result;
+
+	gbAsyncHead = (gbAsyncHead + 1) % MAXNUM_ASYNC_QUEUE;
+	gbAsyncCount--;
+	gbAsyncActive = 0;
+	giBusUsing = 0;
+
+	t->result = (unsigned char)result;
+	if( t->done )
+		t->done( t );
+	dxl_async_start();
+}
+
+// Wait for the status packet of the next servo of a bulk read, if it sends
+// one.
+void dxl_async_expect_bulk( struct dxl_transaction *t )
+{
+	struct dxl_bulk_entry *entry = &t->bulk[gbAsyncEntry];
+
+	if( !dxl_reply_expected( entry->id, INST_BULK_READ ) )
+	{
+		dxl_async_finish( COMM_RXFAIL );
+		return;
+	}
+	gbAsyncRxLength = 0;
+	dxl_hal_set_alarm( dxl_hal_rx_time_us( entry->length + 6 ), dxl_async_timeout );
+}
+
+// Store the status packet just received in the bulk read entry it answers,
+// then wait for the next servo, or end the transaction after the last.
+void dxl_async_store_bulk( struct dxl_transaction *t )
+{
+	struct dxl_bulk_entry *entry = &t->bulk[gbAsyncEntry];
+	unsigned char i;
+
+	if( gbAsyncPacket[LENGTH] != entry->length + 2 )
+	{
+		dxl_async_finish( COMM_RXCORRUPT );
+		return;
+	}
+	t->error |= gbAsyncPacket[ERRBIT];
+	for( i=0; i<entry->length; i++ )
+		entry->data[i] = gbAsyncPacket[PARAMETER+i];
+	entry->result = COMM_RXSUCCESS;
+
+	if( ++gbAsyncEntry == dxl_async_bulk_count( t ) )
+		dxl_async_finish( COMM_RXSUCCESS );
+	else
+		dxl_async_expect_bulk( t );
+}
+
+void dxl_async_rx_byte( unsigned char data )
+{
+	struct dxl_transaction *t = gpAsyncQueue[gbAsyncHead];
+	unsigned char i, total, id;
+	unsigned char checksum = 0;
+
+	// Find the 0xff 0xff header
+	if( gbAsyncRxLength < 2 )
+	{
+		if( data == 0xff )
+			gbAsyncPacket[gbAsyncRxLength++] = data;
+		else
+			gbAsyncRxLength = 0;
+		return;
+	}
+	if( gbAsyncRxLength == 2 && data == 0xff )
+		return;
+
+	gbAsyncPacket[gbAsyncRxLength++] = data;
+	if( gbAsyncRxLength <= LENGTH )
+		return;
+
+	id = t->bulk ? t->bulk[gbAsyncEntry].id : t->id;
+	total = gbAsyncPacket[LENGTH] + 4;
+	if( gbAsyncPacket[LENGTH] < 2 || total > sizeof(gbAsyncPacket)
+		|| gbAsyncPacket[ID] != id )
+	{
+		dxl_async_finish( COMM_RXCORRUPT );
+		return;
+	}
+	if( gbAsyncRxLength < total )
+		return;
+
+	for( i=0; i<(gbAsyncPacket[LENGTH]+1); i++ )
+		checksum += gbAsyncPacket[i+2];
+	checksum = ~checksum;
+	if( gbAsyncPacket[total-1] != checksum )
+	{
+		dxl_async_finish( COMM_RXCORRUPT );
+		return;
+	}
+
+	if( t->bulk )
+	{
+		dxl_async_store_bulk( t );
+		return;
+	}
+	t->error = gbAsyncPacket[ERRBIT];
+	t->num_param = gbAsyncPacket[LENGTH] - 2;
+	for( i=0; i<t->num_param; i++ )
+		t->param[i] = gbAsyncPacket[PARAMETER+i];
+	dxl_async_finish( COMM_RXSUCCESS );
+}
+
+void dxl_async_timeout(void)
+{
+	if( gbAsyncRxLength == 0 )
+		dxl_async_finish( COMM_RXTIMEOUT );
+	else
+		dxl_async_finish( COMM_RXCORRUPT );
+}
+
+void dxl_async_tx_done(void)
+{
+	struct dxl_transaction *t = gpAsyncQueue[gbAsyncHead];
+
+	DXL_TRACE( DXL_TRACE_TX_END );
+	if( t->bulk )
+	{
+		DXL_TRACE( DXL_TRACE_RX_START );
+		t->error = 0;
+		dxl_hal_set_rx_hook( dxl_async_rx_byte );
+		dxl_async_expect_bulk( t );
+		return;
+	}
+	if( t->reply == DXL_NO_REPLY || !dxl_reply_expected( t->id, t->instruction ) )
+	{
+		dxl_async_finish( COMM_TXSUCCESS );
+		return;
+	}
+
+	DXL_TRACE( DXL_TRACE_RX_START );
+	gbAsyncRxLength = 0;
+	dxl_hal_set_rx_hook( dxl_async_rx_byte );
+	dxl_hal_set_alarm( dxl_hal_rx_time_us( t->reply + 6 ), dxl_async_timeout );
+}
+
+// Send the transaction at the head of the queue, unless one is in progress
+// or a blocking packet holds the bus. Called with interrupts disabled.
+void dxl_async_start(void)
+{
+	struct dxl_transaction *t;
+	unsigned char i;
+	unsigned char checksum = 0;
+
+	if( gbAsyncCount == 0 || gbAsyncActive || giBusUsing )
+		return;
+
+	t = gpAsyncQueue[gbAsyncHead];
+	gbAsyncActive = 1;
+	gbAsyncEntry = 0;
+	giBusUsing = 1;
+	DXL_TRACE( DXL_TRACE_TX_START );
+
+	gbAsyncPacket[0] = 0xff;
+	gbAsyncPacket[1] = 0xff;
+	gbAsyncPacket[ID] = t->id;
+	gbAsyncPacket[LENGTH] = t->num_param + 2;
+	gbAsyncPacket[INSTRUCTION] = t->instruction;
+	for( i=0; i<t->num_param; i++ )
+		gbAsyncPacket[PARAMETER+i] = t->param[i];
+	for( i=0; i<(gbAsyncPacket[LENGTH]+1); i++ )
+		checksum += gbAsyncPacket[i+2];
+	gbAsyncPacket[gbAsyncPacket[LENGTH]+3] = ~checksum;
+
+	dxl_hal_tx_start( gbAsyncPacket, gbAsyncPacket[LENGTH] + 4, dxl_async_tx_done );
+}
+
+int dxl_async_submit( struct dxl_transaction *t )
+{
+	// Queue 't' and return at once. Its result is COMM_RXWAITING until the
+	// transaction is over, when 'done' is called from the interrupt.
+	// Returns 0 if the queue is full or 't' does not fit in a packet.
+	unsigned char sreg;
+
+	if( t->num_param > MAXNUM_ASYNC_PARAM
+		|| (t->reply != DXL_NO_REPLY && t->reply > MAXNUM_ASYNC_PARAM) )
+	{
+		t->result = COMM_TXERROR;
+		return 0;
+	}
+
+	sreg = SREG;
+	cli();
+	if( gbAsyncCount == MAXNUM_ASYNC_QUEUE )
+	{
+		SREG = sreg;
+		return 0;
+	}
+	t->result = COMM_RXWAITING;
+	gpAsyncQueue[(gbAsyncHead + gbAsyncCount) % MAXNUM_ASYNC_QUEUE] = t;
+	gbAsyncCount++;
+	dxl_async_start();
+	SREG = sreg;
+	return 1;
+}
+
+int dxl_async_idle(void)
+{
+	return gbAsyncCount == 0;
+}
+
+// Wait for the queue to empty, then claim the bus for a blocking packet.
+// Check and claim happen with interrupts disabled, so a transaction queued
+// from an interrupt cannot start in between. Returns 0 if a blocking packet
+// of an interrupted caller already holds the bus.
+int dxl_async_claim_bus(void)
+{
+	unsigned char sreg;
+
+	while( 1 )
+	{
+		sreg = SREG;
+		cli();
+		if( gbAsyncCount == 0 )
+			break;
+		SREG = sreg;
+	}
+	if( giBusUsing )
+	{
+		SREG = sreg;
+		return 0;
+	}
+	giBusUsing = 1;
+	SREG = sreg;
+	return 1;
+}
+
+int dxl_async_sync_write_words( struct dxl_transaction *t, int address, int *ids, int *values, int num )
+{
+	int i;
+
+	if( num > MAXNUM_ASYNC_SYNC_WORDS )
+	{
+		t->result = COMM_TXERROR;
+		return 0;
+	}
+
+	t->id = BROADCAST_ID;
+	t->instruction = INST_SYNC_WRITE;
+	t->param[0] = (unsigned char)address;
+	t->param[1] = 2;
+	for( i=0; i<num; i++ )
+	{
+		t->param[2+3*i] = (unsigned char)ids[i];
+		t->param[2+3*i+1] = (unsigned char)dxl_get_lowbyte(values[i]);
+		t->param[2+3*i+2] = (unsigned char)dxl_get_highbyte(values[i]);
+	}
+	t->num_param = (2+1)*num + 2;
+	t->reply = DXL_NO_REPLY;
+	t->bulk = 0;
+	return dxl_async_submit( t );
+}
+
+// Read entries[i].length bytes from entries[i].address of servo
+// entries[i].id into entries[i].data, for 'num' servos, with one
+// INST_BULK_READ transaction. Each entry's result is COMM_RXWAITING until
+// its status packet is in. Returns 0 if the queue is full or the read does
+// not fit in a transaction.
+int dxl_async_bulk_read( struct dxl_transaction *t, struct dxl_bulk_entry *entries, int num )
+{
+	int i;
+
+	if( num <= 0 || num > MAXNUM_ASYNC_BULK_READ )
+	{
+		t->result = COMM_TXERROR;
+		return 0;
+	}
+
+	t->id = BROADCAST_ID;
+	t->instruction = INST_BULK_READ;
+	t->param[0] = 0;
+	for( i=0; i<num; i++ )
+	{
+		if( entries[i].length > MAXNUM_ASYNC_PARAM )
+		{
+			t->result = COMM_TXERROR;
+			return 0;
+		}
+		t->param[1+3*i] = entries[i].length;
+		t->param[1+3*i+1] = entries[i].id;
+		t->param[1+3*i+2] = entries[i].address;
+		entries[i].result = COMM_RXWAITING;
+	}
+	t->num_param = 3*num + 1;
+	t->reply = 0;
+	t->bulk = entries;
+	return dxl_async_submit( t );
+}
@@ -1,9 +1,11 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
-#include <util/delay.h>
 #include "dxl_hal.h"
 
 #define MAXNUM_DXLBUFF	256
+#define TIMER_COUNT_US	2	// timer 3 counts per microsecond
+#define DEFAULT_RETURN_DELAY_US	500	// factory Return Delay Time, register 250
+#define RETURN_DELAY_MARGIN_US	100	// servo clock tolerance and turnaround
 // Porting
 #define DIR_TXD 	PORTE &= ~0x08, PORTE |= 0x04
 #define DIR_RXD 	PORTE &= ~0x04, PORTE |= 0x08
@@ -12,12 +14,18 @@
 volatile unsigned char gbDxlBuffer[MAXNUM_DXLBUFF] = {0};
 volatile unsigned char gbDxlBufferHead = 0;
 volatile unsigned char gbDxlBufferTail = 0;
-volatile double gfByteTransTime_us;
-volatile unsigned int gwCountNum;
-volatile unsigned int gwTimeoutCountNum;
-volatile unsigned int gwReturnDelayCountNum;
+volatile unsigned int gwByteTransCount;		// timer 3 counts per byte, with margin
+volatile unsigned int gwReturnDelayCount;	// with margin
+volatile unsigned char gbTimeoutWraps;
+volatile unsigned char *gpTxPacket;
+volatile unsigned char gbTxLeft = 0;
+volatile unsigned char gbTxBusy = 0;
+void (*gpTxDone)(void) = 0;
+void (*gpRxHook)(unsigned char data) = 0;
+void (*gpAlarmHook)(void) = 0;
 
 int dxl_hal_get_qstate(void);
+void dxl_hal_tx_end(void);
 void dxl_hal_put_queue( unsigned char data );
 unsigned char dxl_hal_get_queue(void);
 
@@ -64,8 +72,13 @@ int dxl_hal_open(int devIndex, float baudrate)
 	UBRR0H = (unsigned char)((Divisor & 0xFF00) >> 8);
 	UBRR0L = (unsigned char)(Divisor & 0x00FF);
 
-	gfByteTransTime_us = 1000000.0 / (double)baudrate * 12.0;
-	gwReturnDelayCountNum = (unsigned int)(250.0 / gfByteTransTime_us);
+	// 12 bit times per byte leave room for gaps between bytes
+	gwByteTransCount = (unsigned int)(1000000.0 * TIMER_COUNT_US / baudrate * 12.0 + 0.5);
+	gwReturnDelayCount = (DEFAULT_RETURN_DELAY_US + RETURN_DELAY_MARGIN_US) * TIMER_COUNT_US;
+
+	// Timer 3 runs free at 2MHz for the timeouts and dxl_hal_set_alarm
+	TCCR3A = 0;
+	TCCR3B = 0x02; // normal mode, clock / 8
 	
 	// initialize
 	DIR_RXD;
@@ -92,21 +105,102 @@ int dxl_hal_tx( unsigned char *pPacket, int numPacket )
 	// *pPacket: data array pointer
 	// numPacket: number of data array
 	// Return: number of data transmitted. -1 is error.	
+	// The bytes go out from the interrupts, which stay enabled, and this
+	// waits until the last one is out. With interrupts disabled it sends
+	// them by hand instead.
 	int count;
 	
-	cli();
-	DIR_TXD;
-	for( count=0; count<numPacket; count++ )
+	if( numPacket <= 0 )
+		return 0;
+
+	if( !bit_is_set(SREG,7) )
 	{
-		while(!bit_is_set(UCSR0A,5));
-		
-		UCSR0A |= 0x40;
-		UDR0 = pPacket[count];
+		DIR_TXD;
+		for( count=0; count<numPacket; count++ )
+		{
+			while(!bit_is_set(UCSR0A,5));
+			
+			UCSR0A |= 0x40;
+			UDR0 = pPacket[count];
+		}
+		while( !bit_is_set(UCSR0A,6) );
+		DIR_RXD;
+		return count;
 	}
-	while( !bit_is_set(UCSR0A,6) );
-	DIR_RXD;
-	sei();
-	return count;
+
+	gbTxBusy = 1;
+	dxl_hal_tx_start( pPacket, numPacket, dxl_hal_tx_end );
+	while( gbTxBusy );
+	return numPacket;
+}
+
+void dxl_hal_tx_end(void)
+{
+	gbTxBusy = 0;
+}
+
+void dxl_hal_tx_start( unsigned char *pPacket, int numPacket, void (*done)(void) )
+{
+	// Start transmitting data from the data register empty interrupt
+	// *pPacket: data array pointer, kept until 'done'
+	// numPacket: number of data array
+	// done: called from the interrupt once the last bit is out and the bus
+	//       direction is back to receive
+	unsigned char sreg;
+
+	if( numPacket <= 0 )
+		return;
+
+	gpTxPacket = pPacket;
+	gbTxLeft = (unsigned char)numPacket;
+	gpTxDone = done;
+	DIR_TXD;
+	sreg = SREG;
+	cli();
+	UCSR0B |= 0x20; // enable data register empty interrupt
+	SREG = sreg;
+}
+
+void dxl_hal_set_rx_hook( void (*hook)(unsigned char data) )
+{
+	// Hand received bytes to 'hook', from the interrupt, instead of to the
+	// buffer dxl_hal_rx reads. 0 for the buffer.
+	gpRxHook = hook;
+}
+
+unsigned long dxl_hal_rx_count( int NumRcvByte )
+{
+	// Maximum timer 3 counts for a status packet of NumRcvByte bytes to
+	// arrive: the servo's return delay, then the bytes with 10 to spare
+	return (unsigned long)(NumRcvByte + 10) * gwByteTransCount + gwReturnDelayCount;
+}
+
+unsigned int dxl_hal_rx_time_us( int NumRcvByte )
+{
+	// Maximum time for a status packet of NumRcvByte bytes to arrive, as
+	// dxl_hal_timeout counts it
+	return (unsigned int)(dxl_hal_rx_count( NumRcvByte ) / TIMER_COUNT_US);
+}
+
+void dxl_hal_set_return_delay( int us )
+{
+	// Wait 'us' microseconds, plus a margin, for a servo to start its status
+	// packet: its Return Delay Time. Servos come with 500us.
+	gwReturnDelayCount = ((unsigned int)us + RETURN_DELAY_MARGIN_US) * TIMER_COUNT_US;
+}
+
+void dxl_hal_set_alarm( unsigned int us, void (*hook)(void) )
+{
+	// Call 'hook' from the timer 3 compare B interrupt in 'us' microseconds
+	// (at most 32767). A 0 hook cancels the alarm.
+	TIMSK3 &= ~0x04;
+	gpAlarmHook = hook;
+	if( hook == 0 )
+		return;
+
+	OCR3B = TCNT3 + us * TIMER_COUNT_US;
+	TIFR3 = 0x04;
+	TIMSK3 |= 0x04;
 }
 
 int dxl_hal_rx( unsigned char *pPacket, int numPacket )
@@ -134,22 +228,27 @@ void dxl_hal_set_timeout( int NumRcvByte )
 {
 	// Start stop watch
 	// NumRcvByte: number of recieving data(to calculate maximum waiting time)
-	gwCountNum = 0;	
-	gwTimeoutCountNum = (NumRcvByte + 10) + gwReturnDelayCountNum;
+	// Timer 3 compare C flags the timeout; waits longer than one timer
+	// period (slow baud rates) count the periods in between.
+	unsigned long count = dxl_hal_rx_count( NumRcvByte );
+
+	gbTimeoutWraps = (unsigned char)((count - 1) >> 16);
+	OCR3C = TCNT3 + (unsigned int)count;
+	TIFR3 = 0x08; // clear output compare C flag
 }
 
 int dxl_hal_timeout(void)
 {
 	// Check timeout
 	// Return: 0 is false, 1 is true(timeout occurred)
-	gwCountNum++;
-		
-	if( gwCountNum > gwTimeoutCountNum )
-	{
+	if( !bit_is_set(TIFR3,3) )
+		return 0;
+
+	if( gbTimeoutWraps == 0 )
 		return 1;
-	}
-	
-	_delay_us(gfByteTransTime_us);
+
+	gbTimeoutWraps--;
+	TIFR3 = 0x08;
 	return 0;
 }
 
@@ -199,5 +298,36 @@ unsigned char dxl_hal_get_queue(void)
 
 SIGNAL(USART0_RX_vect)
 {
-	dxl_hal_put_queue( UDR0 );
-}
\ No newline at end of file
+	unsigned char data = UDR0;
+
+	if( gpRxHook )
+		gpRxHook( data );
+	else
+		dxl_hal_put_queue( data );
+}
+
+SIGNAL(USART0_UDRE_vect)
+{
+	UCSR0A |= 0x40; // clear transmit complete
+	UDR0 = *gpTxPacket++;
+	if( --gbTxLeft == 0 )
+	{
+		UCSR0B &= ~0x20;
+		UCSR0B |= 0x40; // enable transmit complete interrupt
+	}
+}
+
+SIGNAL(USART0_TX_vect)
+{
+	UCSR0B &= ~0x40;
+	DIR_RXD;
+	if( gpTxDone )
+		gpTxDone();
+}
+
+SIGNAL(TIMER3_COMPB_vect)
+{
+	TIMSK3 &= ~0x04;
+	if( gpAlarmHook )
+		gpAlarmHook();
+}
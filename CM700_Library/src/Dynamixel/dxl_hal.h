@@ -14,6 +14,12 @@ int dxl_hal_tx( unsigned char *pPacket, int numPacket );
 int dxl_hal_rx( unsigned char *pPacket, int numPacket );
 void dxl_hal_set_timeout( int NumRcvByte );
 int dxl_hal_timeout(void);
+void dxl_hal_tx_start( unsigned char *pPacket, int numPacket, void (*done)(void) );
+void dxl_hal_set_rx_hook( void (*hook)(unsigned char data) );
+unsigned long dxl_hal_rx_count( int NumRcvByte );
+unsigned int dxl_hal_rx_time_us( int NumRcvByte );
+void dxl_hal_set_return_delay( int us );
+void dxl_hal_set_alarm( unsigned int us, void (*hook)(void) );
 
 
 
@@ -14,6 +14,13 @@ unsigned char gbRxPacketLength = 0;
 unsigned char gbRxGetLength = 0;
 int gbCommStatus = COMM_RXSUCCESS;
 int giBusUsing = 0;
+void (*gpTraceHook)(int event) = 0;
+unsigned char gbNoReadReply[32] = {0};		// bit per ID: status return level 0
+unsigned char gbNoWriteReply[32] = {0};		// bit per ID: status return level 0 or 1
+
+#define DXL_TRACE(event)	if( gpTraceHook ) gpTraceHook(event)
+
+int dxl_async_claim_bus(void);
 
 
 int dxl_initialize( int devIndex, int baudnum )
@@ -34,16 +41,25 @@ void dxl_terminate()
 	dxl_hal_close();
 }
 
+// Tighten the status packet timeout to the servos' Return Delay Time, in
+// microseconds (twice the register value). Servos come with 500us.
+void dxl_set_return_delay( int us )
+{
+	dxl_hal_set_return_delay( us );
+}
+
 void dxl_tx_packet()
 {
 	unsigned char i;
 	unsigned char TxNumByte, RealTxNumByte;
 	unsigned char checksum = 0;
 
-	if( giBusUsing == 1 )
+	if( !dxl_async_claim_bus() )
+	{
+		gbCommStatus = COMM_TXFAIL;
 		return;
-	
-	giBusUsing = 1;
+	}
+	DXL_TRACE( DXL_TRACE_TX_START );
 
 	if( gbInstructionPacket[LENGTH] > (MAXNUM_TXPARAM+2) )
 	{
@@ -58,7 +74,8 @@ void dxl_tx_packet()
 		&& gbInstructionPacket[INSTRUCTION] != INST_REG_WRITE
 		&& gbInstructionPacket[INSTRUCTION] != INST_ACTION
 		&& gbInstructionPacket[INSTRUCTION] != INST_RESET
-		&& gbInstructionPacket[INSTRUCTION] != INST_SYNC_WRITE )
+		&& gbInstructionPacket[INSTRUCTION] != INST_SYNC_WRITE
+		&& gbInstructionPacket[INSTRUCTION] != INST_BULK_READ )
 	{
 		gbCommStatus = COMM_TXERROR;
 		giBusUsing = 0;
@@ -76,6 +93,7 @@ void dxl_tx_packet()
 
 	TxNumByte = gbInstructionPacket[LENGTH] + 4;
 	RealTxNumByte = dxl_hal_tx( (unsigned char*)gbInstructionPacket, TxNumByte );
+	DXL_TRACE( DXL_TRACE_TX_END );
 
 	if( TxNumByte != RealTxNumByte )
 	{
@@ -100,9 +118,14 @@ void dxl_rx_packet()
 	if( giBusUsing == 0 )
 		return;
 
-	if( gbInstructionPacket[ID] == BROADCAST_ID )
+	if( gbInstructionPacket[ID] == BROADCAST_ID
+		|| !dxl_reply_expected( gbInstructionPacket[ID], gbInstructionPacket[INSTRUCTION] ) )
 	{
-		gbCommStatus = COMM_RXSUCCESS;
+		if( gbInstructionPacket[INSTRUCTION] == INST_READ
+			|| gbInstructionPacket[INSTRUCTION] == INST_BULK_READ )
+			gbCommStatus = COMM_RXFAIL;
+		else
+			gbCommStatus = COMM_RXSUCCESS;
 		giBusUsing = 0;
 		return;
 	}
@@ -111,6 +134,7 @@ void dxl_rx_packet()
 	{
 		gbRxGetLength = 0;
 		gbRxPacketLength = 6;
+		DXL_TRACE( DXL_TRACE_RX_START );
 	}
 	
 	nRead = dxl_hal_rx( (unsigned char*)&gbStatusPacket[gbRxGetLength], gbRxPacketLength - gbRxGetLength );
@@ -120,9 +144,15 @@ void dxl_rx_packet()
 		if( dxl_hal_timeout() == 1 )
 		{
 			if(gbRxGetLength == 0)
+			{
 				gbCommStatus = COMM_RXTIMEOUT;
+				DXL_TRACE( DXL_TRACE_RX_TIMEOUT );
+			}
 			else
+			{
 				gbCommStatus = COMM_RXCORRUPT;
+				DXL_TRACE( DXL_TRACE_RX_END );
+			}
 			giBusUsing = 0;
 			return;
 		}
@@ -158,6 +188,7 @@ void dxl_rx_packet()
 	if( gbInstructionPacket[ID] != gbStatusPacket[ID])
 	{
 		gbCommStatus = COMM_RXCORRUPT;
+		DXL_TRACE( DXL_TRACE_RX_END );
 		giBusUsing = 0;
 		return;
 	}
@@ -182,11 +213,13 @@ void dxl_rx_packet()
 	if( gbStatusPacket[gbStatusPacket[LENGTH]+3] != checksum )
 	{
 		gbCommStatus = COMM_RXCORRUPT;
+		DXL_TRACE( DXL_TRACE_RX_END );
 		giBusUsing = 0;
 		return;
 	}
 	
 	gbCommStatus = COMM_RXSUCCESS;
+	DXL_TRACE( DXL_TRACE_RX_END );
 	giBusUsing = 0;
 }
 
@@ -202,6 +235,55 @@ void dxl_txrx_packet()
 	}while( gbCommStatus == COMM_RXWAITING );	
 }
 
+// Record the Status Return Level of servo 'id', so packets it does not
+// answer are not waited for. Servos start out at STATUS_RETURN_ALL.
+void dxl_set_status_return( int id, int level )
+{
+	unsigned char bit = 1 << (id & 7);
+
+	if( id < 0 || id >= BROADCAST_ID )
+		return;
+
+	gbNoReadReply[id >> 3] &= ~bit;
+	gbNoWriteReply[id >> 3] &= ~bit;
+	if( level == STATUS_RETURN_NONE )
+		gbNoReadReply[id >> 3] |= bit;
+	if( level != STATUS_RETURN_ALL )
+		gbNoWriteReply[id >> 3] |= bit;
+}
+
+int dxl_get_status_return( int id )
+{
+	unsigned char bit = 1 << (id & 7);
+
+	if( id < 0 || id >= BROADCAST_ID )
+		return STATUS_RETURN_NONE;
+	if( gbNoReadReply[id >> 3] & bit )
+		return STATUS_RETURN_NONE;
+	if( gbNoWriteReply[id >> 3] & bit )
+		return STATUS_RETURN_READ;
+	return STATUS_RETURN_ALL;
+}
+
+// Whether servo 'id' answers 'instruction' with a status packet.
+int dxl_reply_expected( int id, int instruction )
+{
+	if( id == BROADCAST_ID )
+		return 0;
+	if( instruction == INST_PING )
+		return 1;
+	if( instruction == INST_READ || instruction == INST_BULK_READ )
+		return dxl_get_status_return( id ) != STATUS_RETURN_NONE;
+	return dxl_get_status_return( id ) == STATUS_RETURN_ALL;
+}
+
+// Set a function to call at the start and end of every packet sent and
+// received, with a DXL_TRACE_ event. 0 for none.
+void dxl_set_trace_hook( void (*hook)(int event) )
+{
+	gpTraceHook = hook;
+}
+
 int dxl_get_result()
 {
 	return gbCommStatus;
@@ -339,3 +421,59 @@ void dxl_write_word( int id, int address, int value )
 	
 	dxl_txrx_packet();
 }
+
+// Write values[i] to the word at 'address' of servo ids[i], for 'num'
+// servos, in one broadcast packet. No servo replies, and all of them act on
+// it at the same time.
+void dxl_sync_write_words( int address, int *ids, int *values, int num )
+{
+	int i;
+
+	if( num > MAXNUM_SYNC_WORDS )
+	{
+		gbCommStatus = COMM_TXERROR;
+		return;
+	}
+
+	while(giBusUsing);
+
+	gbInstructionPacket[ID] = (unsigned char)BROADCAST_ID;
+	gbInstructionPacket[INSTRUCTION] = INST_SYNC_WRITE;
+	gbInstructionPacket[PARAMETER] = (unsigned char)address;
+	gbInstructionPacket[PARAMETER+1] = 2;
+	for( i=0; i<num; i++ )
+	{
+		gbInstructionPacket[PARAMETER+2+3*i] = (unsigned char)ids[i];
+		gbInstructionPacket[PARAMETER+2+3*i+1] = (unsigned char)dxl_get_lowbyte(values[i]);
+		gbInstructionPacket[PARAMETER+2+3*i+2] = (unsigned char)dxl_get_highbyte(values[i]);
+	}
+	gbInstructionPacket[LENGTH] = (2+1)*num + 4;
+	
+	dxl_txrx_packet();
+}
+
+void dxl_sync_write_bytes( int address, int *ids, int *values, int num )
+{
+	int i;
+
+	if( num > MAXNUM_SYNC_BYTES )
+	{
+		gbCommStatus = COMM_TXERROR;
+		return;
+	}
+
+	while(giBusUsing);
+
+	gbInstructionPacket[ID] = (unsigned char)BROADCAST_ID;
+	gbInstructionPacket[INSTRUCTION] = INST_SYNC_WRITE;
+	gbInstructionPacket[PARAMETER] = (unsigned char)address;
+	gbInstructionPacket[PARAMETER+1] = 1;
+	for( i=0; i<num; i++ )
+	{
+		gbInstructionPacket[PARAMETER+2+2*i] = (unsigned char)ids[i];
+		gbInstructionPacket[PARAMETER+2+2*i+1] = (unsigned char)values[i];
+	}
+	gbInstructionPacket[LENGTH] = (1+1)*num + 4;
+	
+	dxl_txrx_packet();
+}
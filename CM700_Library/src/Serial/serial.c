@@ -4,6 +4,7 @@
 #include "serial.h"
 
 #define MAXNUM_SERIALBUFF	128
+#define MAXNUM_TXBUFF		128
 #define DEFAULT_BAUDRATE	34 // 57132(57600)bps
 
 #define DIR_RXD 	PORTE &= ~0x04, PORTE |= 0x08
@@ -11,11 +12,15 @@
 volatile unsigned char gbSerialBuffer[MAXNUM_SERIALBUFF] = {0};
 volatile unsigned char gbSerialBufferHead = 0;
 volatile unsigned char gbSerialBufferTail = 0;
+volatile unsigned char gbSerialTxBuffer[MAXNUM_TXBUFF] = {0};
+volatile unsigned char gbSerialTxHead = 0;
+volatile unsigned char gbSerialTxTail = 0;
 static FILE *device;
 
 
 void serial_put_queue( unsigned char data );
 unsigned char serial_get_queue(void);
+void serial_tx_next(void);
 int std_putchar(char c);
 int std_getchar(void);
 
@@ -23,7 +28,7 @@ int std_getchar(void);
 void serial_initialize(long ubrr)
 {
 	// Serial communication using UART1
-	int baud = (unsigned short)(2000000.0 / ubrr) - 1;
+	int baud = (unsigned short)(2000000.0 / ubrr + 0.5) - 1;
 
 	// set UART register A
 	//Bit 7: USART Receive Complete
@@ -39,6 +44,7 @@ void serial_initialize(long ubrr)
 	// set UART register B
 	// bit7: enable rx interrupt
     // bit6: enable tx interrupt
+    // bit5: enable data register empty interrupt (set while sending)
     // bit4: enable rx
     // bit3: enable tx
     // bit2: set sendding size(0 = 8bit)
@@ -55,6 +61,8 @@ void serial_initialize(long ubrr)
 	UDR1 = 0xFF;
 	gbSerialBufferHead = 0;
 	gbSerialBufferTail = 0;
+	gbSerialTxHead = 0;
+	gbSerialTxTail = 0;
 
 	// set baudrate
 	UBRR1H = (unsigned char)(baud>>8);
@@ -63,15 +71,103 @@ void serial_initialize(long ubrr)
 	device = fdevopen( std_putchar, std_getchar );
 }
 
+// Change the baudrate once every queued byte has been sent. The divisor is
+// rounded to the nearest, as in serial_initialize. Returns the real baudrate.
+long serial_set_baudrate(long baudrate)
+{
+	unsigned short baud = (unsigned short)((2000000L + baudrate / 2) / baudrate) - 1;
+
+	serial_flush();
+	UBRR1H = (unsigned char)(baud>>8);
+	UBRR1L = (unsigned char)(baud & 0xFF);
+	return 2000000L / (baud + 1);
+}
+
+// Wait until every queued byte has left the transmitter.
+void serial_flush(void)
+{
+	while( gbSerialTxHead != gbSerialTxTail )
+	{
+		if( !bit_is_set(SREG,7) && bit_is_set(UCSR1A,5) )
+			serial_tx_next();
+	}
+	// serial_tx_next clears transmit complete with every byte
+	while( !bit_is_set(UCSR1A,6) );
+}
+
+// Queue all bytes for the data register empty interrupt, waiting only while
+// the TX buffer is full.
 void serial_write( unsigned char *pData, int numbyte )
+{
+	int count = 0;
+
+	while( count < numbyte )
+	{
+		count += serial_try_write( pData + count, numbyte - count );
+		// With interrupts off, nothing drains the buffer: send by hand
+		if( count < numbyte && !bit_is_set(SREG,7) && bit_is_set(UCSR1A,5) )
+			serial_tx_next();
+	}
+}
+
+// Queue as many bytes as fit in the TX buffer, without waiting.
+// Returns the number of bytes queued.
+int serial_try_write( unsigned char *pData, int numbyte )
 {
 	int count;
+	unsigned char next, sreg;
 
 	for( count=0; count<numbyte; count++ )
 	{
-		while(!bit_is_set(UCSR1A,5));
-		UDR1 = pData[count];
+		if( gbSerialTxTail == (MAXNUM_TXBUFF-1) )
+			next = 0;
+		else
+			next = gbSerialTxTail + 1;
+		if( next == gbSerialTxHead )
+			break;
+		gbSerialTxBuffer[gbSerialTxTail] = pData[count];
+		gbSerialTxTail = next;
+	}
+
+	if( count > 0 )
+	{
+		sreg = SREG;
+		cli();
+		UCSR1B |= 0x20; // enable data register empty interrupt
+		SREG = sreg;
 	}
+	return count;
+}
+
+// Number of bytes serial_try_write can queue now.
+int serial_get_txfree(void)
+{
+	short NumByte;
+
+	if( gbSerialTxHead <= gbSerialTxTail )
+		NumByte = gbSerialTxTail - gbSerialTxHead;
+	else
+		NumByte = MAXNUM_TXBUFF - (gbSerialTxHead - gbSerialTxTail);
+
+	return (int)(MAXNUM_TXBUFF - 1 - NumByte);
+}
+
+// Send the next queued byte, or stop the interrupt once there is none.
+void serial_tx_next(void)
+{
+	if( gbSerialTxHead == gbSerialTxTail )
+	{
+		UCSR1B &= ~0x20;
+		return;
+	}
+
+	UCSR1A |= 0x40; // clear transmit complete
+	UDR1 = gbSerialTxBuffer[gbSerialTxHead];
+
+	if( gbSerialTxHead == (MAXNUM_TXBUFF-1) )
+		gbSerialTxHead = 0;
+	else
+		gbSerialTxHead++;
 }
 
 unsigned char serial_read( unsigned char *pData, int numbyte )
@@ -140,8 +236,14 @@ SIGNAL(USART1_RX_vect)
 	serial_put_queue( UDR1 );
 }
 
+SIGNAL(USART1_UDRE_vect)
+{
+	serial_tx_next();
+}
+
 
 
+// Never waits: characters that do not fit in the TX buffer are dropped.
 int std_putchar(char c)
 {
 	char tx[2];
@@ -150,12 +252,13 @@ int std_putchar(char c)
 	{
         tx[0] = '\r';
 		tx[1] = '\n';
-		serial_write( (unsigned char*)tx, 2 );
+		if( serial_get_txfree() >= 2 )
+			serial_try_write( (unsigned char*)tx, 2 );
 	}
 	else
 	{
 		tx[0] = c;
-		serial_write( (unsigned char*)tx, 1 );
+		serial_try_write( (unsigned char*)tx, 1 );
 	}
  
     return 0;
@@ -11,6 +11,7 @@
 #include <avr/io.h>
 #include <util/delay.h>
 #include <avr/interrupt.h>
+#include <util/atomic.h>
 #include "serial.h"
 #include "dynamixel.h"
 #include <stdio.h>
@@ -19,17 +20,23 @@
 #include <math.h>
 #include <float.h>
 #include "functions.h"
+#include "workspace.h"
+#include "protocol.h"
+#include "parser.h"
+#include "queue.h"
+#include "scheduler.h"
+#include "motion.h"
+#include "planner.h"
+#include "gcode.h"
+#include "telemetry.h"
+#include "debuglog.h"
+#include "trace.h"
+#include "servoconfig.h"
 
 
 //Define state machine values
-#define WATCH_BEGIN 1
-#define WATCH_X 2
-#define WATCH_Y 3
-#define WATCH_Z 4
 #define OLD_DATA 5
 #define NEW_DATA 6
-#define POSITIVE 7
-#define NEGATIVE 8
 #define CONFIRM_DATA 9
 #define SEND_DATA 10
 
@@ -46,37 +53,74 @@
 #define P_PRESENT_POSITION_H	37
 #define P_MOVING				46
 
+#define TICKS_PER_DEGREE	11.3778 //4096./360
+#define MAX_TICKS			4095 // Goal positions run from 0 to MAX_TICKS
+
 // Default setting
 #define DEFAULT_BAUDNUM		1 // 1Mbps
 #define DEFAULT_ID			1
 
+#define REPLY_ROOM			12 // TX buffer bytes for "error:255\r\n", as printf drops what does not fit
+
 //Declare global variables
-int parseState = WATCH_BEGIN;
 int dataState = OLD_DATA;
 int positionDataType = POSITION;
 
-double xBuffer = 0;
-double yBuffer = 0;
-double zBuffer = -8.5;
-int signState = POSITIVE;
+struct parser asciiParser; // Fields of the last ASCII command, in thou or ticks
+struct gcode gcodeInterp; // G-code modes and position
+unsigned char gcodePending = 0; // A G-code line is waiting for queue room
+unsigned char gcodeMode = 0; // Other ASCII bytes are G-code, after CMD_GCODE
+
+unsigned char expectedSequence = 0;
+unsigned int frameErrors = 0; // Corrupt frames, plus frames lost before a good one
+unsigned int queueOverflows = 0; // Setpoints dropped because the queue was full
+unsigned char creditDue = 0; // Host is owed a CMD_CREDIT frame
+unsigned char reportedFree = 0; // Free slots in the last CMD_CREDIT frame
+int32_t holdTime = 0; // Microseconds until servoTick takes the next setpoint
+unsigned char telemetrySequence = 0; // Counts CMD_TELEMETRY frames sent
+struct point measuredPoint; // Last forward kinematics, the next first guess
+unsigned char measuredValid = 0;
+struct dxl_transaction goalWrite; // Sync write of the last goal positions
+unsigned int goalWaits = 0; // Goal writes that waited for room in the bus queue
+long linkBaud = LINK_DEFAULT_BAUD; // Host link baud rate
+long linkFallback = 0; // Rate to go back to if the new one is not confirmed
+uint32_t linkDeadline = 0; // schedulerTime() by which to confirm it
 
 
 //Declare functions
 
 int parseAll(char dataIn);
+int ticksValid(int32_t ticks[3]);
+void handleFrame(struct frame* f);
+void sendCredit(void);
+void enqueue(unsigned char type, int16_t v1, int16_t v2, int16_t v3, uint16_t param);
+void enqueueWaypoints(struct frame* f);
+void enqueueBezier(struct frame* f);
+void enqueueArc(struct frame* f);
+void runSetpoint(struct setpoint* s);
+void servoTick(void);
+void stepSetpoints(void);
+void sendTelemetry(struct telemetry* t);
+void changeBaud(struct frame* f);
+void checkBaud(void);
+void sendStats(void);
+int moveToPoint(struct point p);
+void writeGoalAngles(double angles[3]);
+void writeGoalTicks(int ticks1, int ticks2, int ticks3);
 void PrintCommStatus(int CommStatus);
 void PrintErrorCode(void);
 
 
 int main(void)
 {
-	serial_initialize(57600); // USART Initialize
+	serial_initialize(LINK_DEFAULT_BAUD); // USART Initialize
 	dxl_initialize( 0, DEFAULT_BAUDNUM ); // Not using device index. i.e., 0 indexing on device number
 	dxl_initialize( 1, DEFAULT_BAUDNUM ); // Init #2
 	dxl_initialize( 2, DEFAULT_BAUDNUM ); // Init #3
 	sei(); // set enable interrupt
 	
 	_delay_ms(1000);
+	servoConfigure(); // Status packets only for reads, shortest return delay
 	
 	//unsigned short GoalPos[2] = {0, 1023};
 	unsigned short GoalPos[2] = {1301, 3999}; // for EX series
@@ -85,15 +129,23 @@ int main(void)
 	int bMoving, wPresentPos;
 	int CommStatus;
 	
+	unsigned char dataIn;
+	struct frame rxFrame;
+	struct telemetry sample;
 	struct point p;
 	double angles[3];
 	angles[0] = 180;
 	angles[1] = 180;
 	angles[2] = 180;
 	
-	dxl_write_word( 1, P_GOAL_POSITION_L, (int) angles[0]*11.3778 ); //4096./360=11.3778  <--- Ticks per degree
-	dxl_write_word( 2, P_GOAL_POSITION_L, (int) angles[1]*11.3778 ); //Command #2
-	dxl_write_word( 3, P_GOAL_POSITION_L, (int) angles[2]*11.3778 ); //Command #3
+	writeGoalAngles(angles);
+	parserReset(&asciiParser);
+	gcodeReset(&gcodeInterp);
+	queueReset();
+	motionReset();
+	plannerReset();
+	traceStart();
+	schedulerStart(SCHED_DEFAULT_HZ, servoTick); // From here on only servoTick uses the bus
 	
 	printf("Initialization complete.\n");
 	
@@ -132,40 +184,67 @@ int main(void)
 		//END DYNAMIXEL DEMO CODE
 		*/
 		
-		if(parseAll(getchar()) != 0){
-			;//printf("\nError!\n");
-			};
+		// Until a G-code line is queued, later bytes stay in the receive
+		// buffer. The host counts the bytes of unanswered lines, so they fit.
+		if(gcodePending){
+			if(serial_get_txfree() >= REPLY_ROOM && gcodeRun(&gcodeInterp) == GCODE_DONE){
+				gcodePending = 0;
+				if(gcodeInterp.result == GCODE_OK)
+					printf("ok\n");
+				else
+					printf("error:%d\n", gcodeInterp.result);
+			}
+		}
+		// Unlike getchar(), serial_read does no '\r' translation, so binary
+		// frames pass through untouched, and it does not block.
+		else if(serial_read(&dataIn, 1)){
+			traceEvent(TRACE_BYTE, dataIn);
+			switch(frameReceive(dataIn, &rxFrame)){
+				case FRAME_IDLE: // Not in a binary frame: ASCII command
+					if(parseAll(dataIn) != 0){
+						LOG(LOG_INPUT_ERROR);
+					};
+					break;
+				case FRAME_READY:
+					traceEvent(TRACE_FRAME, rxFrame.command);
+					linkFallback = 0; // A good frame confirms the baud rate
+					handleFrame(&rxFrame);
+					break;
+				case FRAME_ERROR:
+					frameErrors++;
+					gcodeDiscardLine(&gcodeInterp); // Lost bytes may have split a line
+					break;
+			}
+		}
 		
 	if(dataState == NEW_DATA && positionDataType == POSITION){
-			p.x = (xBuffer)/1000.;
-			p.y = (yBuffer)/1000.;
-			p.z = (zBuffer)/1000.;
+			p.x = asciiParser.values[0]/1000.;
+			p.y = asciiParser.values[1]/1000.;
+			p.z = asciiParser.values[2]/1000.;
 			
-			;//printf("\n\nNew input received\n");
+			LOG_DEBUG(LOG_NEW_INPUT, p.x, p.y, p.z);
 			
-			;//printf("\nIn inches:\nX: %f\nY: %f\nZ: %f\n", p.x, p.y, p.z);
+			p = projectToWorkspace(p); // Clamp onto the pen workspace
 			
 			if (pointValid(p)){
-				;//printf("\nPoint is Valid.\n");
+				LOG_DEBUG(LOG_POINT_VALID);
 				lookupAngles(INVERSE_TABLE, angles, p);
 				
 				if (isnan(angles[0])){
-					;//printf("No Kinematic Solution.");
+					LOG(LOG_NO_SOLUTION);
 				}
 				else{
-					;//printf("\nProposed position:\n");
-					;//printf("X Pos: %f;  Y Pos: %f;  Z Pos: %f\n", p.x, p.y, p.z);
-					;//printf("Angle 1: %f;  Angle 2: %f;  Angle 3: %f\n", angles[0], angles[1], angles[2]);
-					;//printf("Motor 1: %f;  Motor 2: %f;  Motor 3: %f\n", (int) angles[0]*11.3778, (int) angles[1]*11.3778, (int) angles[2]*11.3778);
-					;//printf("Confirm?? (y/n)\n");
+					LOG_DEBUG(LOG_PROPOSED_POINT, p.x, p.y, p.z);
+					LOG_DEBUG(LOG_PROPOSED_ANGLES, angles[0], angles[1], angles[2]);
+					LOG_DEBUG(LOG_PROPOSED_TICKS, (int) (angles[0]*TICKS_PER_DEGREE), (int) (angles[1]*TICKS_PER_DEGREE), (int) (angles[2]*TICKS_PER_DEGREE));
+					LOG_DEBUG(LOG_CONFIRM);
 					dataState = SEND_DATA;
 				}
 			
 				dataState = CONFIRM_DATA;
 			}
 			else{
-				;//printf("Point is not Valid.\n");
-				;//printf("Abort.\n\n");
+				LOG(LOG_POINT_INVALID);
 				dataState = OLD_DATA;
 			}
 
@@ -174,19 +253,31 @@ int main(void)
 			
 		}
 		else if(dataState == NEW_DATA){//receiving angle command
-			dxl_write_word( 1, P_GOAL_POSITION_L, (int) xBuffer ); //4096./360=11.3778  <--- Ticks per degree
-			dxl_write_word( 2, P_GOAL_POSITION_L, (int) yBuffer ); //Command #2
-			dxl_write_word( 3, P_GOAL_POSITION_L, (int) zBuffer ); //Command #3
+			if(ticksValid(asciiParser.values))
+				enqueue(SETPOINT_TICKS, asciiParser.values[0], asciiParser.values[1], asciiParser.values[2], 0);
+			else
+				LOG(LOG_INPUT_ERROR);
 			dataState = OLD_DATA;
 		}
 		else if((dataState == SEND_DATA)){
-			dxl_write_word( 1, P_GOAL_POSITION_L, (int) angles[0]*11.3778 ); //4096./360=11.3778  <--- Ticks per degree
-			dxl_write_word( 2, P_GOAL_POSITION_L, (int) angles[1]*11.3778 ); //Command #2
-			dxl_write_word( 3, P_GOAL_POSITION_L, (int) angles[2]*11.3778 ); //Command #3
-			;//printf("Command sent!\n\n");
+			enqueue(SETPOINT_POSITION, floor(p.x*1000 + 0.5), floor(p.y*1000 + 0.5), floor(p.z*1000 + 0.5), 0);
+			LOG_DEBUG(LOG_COMMAND_SENT);
 			dataState = OLD_DATA;
 		}
 		
+		// servoTick drains the queue; tell the host once there is room again,
+		// and once the queue is empty, which live tracking waits for
+		if(reportedFree < QUEUE_CAPACITY/2 && queueFree() > reportedFree)
+			creditDue = 1;
+		if(reportedFree < QUEUE_CAPACITY && queueFree() == QUEUE_CAPACITY)
+			creditDue = 1;
+		if(creditDue)
+			sendCredit();
+		if(telemetryGet(&sample))
+			sendTelemetry(&sample);
+		if(linkFallback)
+			checkBaud();
+		
 
 	}
 	return 1;
@@ -194,174 +285,466 @@ int main(void)
 
 //Begin general function declarations
 
-int parseAll(char dataIn){
-	int parseError = 0;
+// Execute a binary command frame. Frames are already CRC checked, so they are
+// queued without the ASCII 'y' confirmation. Every frame is answered with a
+// CMD_CREDIT frame.
+void handleFrame(struct frame* f){
+	frameErrors += (unsigned char)(f->sequence - expectedSequence);
+	expectedSequence = f->sequence + 1;
 	
-	switch (parseState){
-		
-		case WATCH_BEGIN:
-			if(dataIn == '$'){//Position Command
-				parseState = WATCH_X;
-				xBuffer = 0;
-				yBuffer = 0;
-				zBuffer = 0;
-				signState = POSITIVE;	
-				positionDataType = POSITION;
-				;//printf("\nReading Packet...\n");
-			}
-			else if(dataIn == '%'){//Angle Command
-				parseState = WATCH_X;
-				xBuffer = 0;
-				yBuffer = 0;
-				zBuffer = 0;
-				signState = POSITIVE;
-				positionDataType = ANGLE;
-				;//printf("\nReading Packet...\n");
-			}
-			else if((dataIn == 'y') && (dataState == CONFIRM_DATA)){
-				dataState = SEND_DATA;
-			}
-			else if((dataIn == 'n') && (dataState == NEW_DATA)){
-				;//printf("\nAbort Send!!\n\n");
-				dataState = OLD_DATA;
-			}
-			else{
-				dataState = OLD_DATA;
-				//printf("waiting on input\n");
-			}
+	switch(f->command){
+		case CMD_POSITION:
+			if(f->length != 6)
+				break;
+			enqueue(SETPOINT_POSITION, frameGetInt16(f, 0), frameGetInt16(f, 2), frameGetInt16(f, 4), 0);
 			break;
-			
-		case WATCH_X:
-			if((dataIn == '0') | (dataIn == '1') | (dataIn == '2') | (dataIn == '3') | (dataIn == '4') | (dataIn == '5') | (dataIn == '6') | (dataIn == '7') | (dataIn == '8') | (dataIn == '9')){
-				xBuffer = (dataIn - '0') + xBuffer*10;
-			}
-			else if(dataIn == ','){
-				parseState = WATCH_Y;
-				if(signState == NEGATIVE)
-					xBuffer = -(xBuffer);
-				signState = POSITIVE;
-				;//printf("Read X: %f thou\n", xBuffer);
-			}
-			else if(dataIn == '-'){
-				signState = NEGATIVE;
-			}
-			else{
-				;//printf("\nBad Data!\n");
-				parseState = WATCH_BEGIN;
-			}
+		case CMD_ANGLE:
+			if(f->length != 6)
+				break;
+			enqueue(SETPOINT_TICKS, frameGetInt16(f, 0), frameGetInt16(f, 2), frameGetInt16(f, 4), 0);
 			break;
-			
-		case WATCH_Y:
-			if((dataIn == '0') | (dataIn == '1') | (dataIn == '2') | (dataIn == '3') | (dataIn == '4') | (dataIn == '5') | (dataIn == '6') | (dataIn == '7') | (dataIn == '8') | (dataIn == '9')){
-				yBuffer = (dataIn - '0') + yBuffer*10;
-			}
-			else if(dataIn == ','){
-				parseState = WATCH_Z;
-				if(signState == NEGATIVE)
-				yBuffer = -(yBuffer);
-				signState = POSITIVE;
-				;//printf("Read Y: %f thou\n", yBuffer);
-			}
-			else if(dataIn == '-'){
-				signState = NEGATIVE;
-			}
-			else{
-				;//printf("\nBad Data!\n");
-				parseState = WATCH_BEGIN;
-			}
+		case CMD_LINE:
+			if(f->length != 8)
+				break;
+			enqueue(SETPOINT_LINE, frameGetInt16(f, 0), frameGetInt16(f, 2), frameGetInt16(f, 4), (uint16_t) frameGetInt16(f, 6));
 			break;
-			
-		case WATCH_Z:
-			if((dataIn == '0') | (dataIn == '1') | (dataIn == '2') | (dataIn == '3') | (dataIn == '4') | (dataIn == '5') | (dataIn == '6') | (dataIn == '7') | (dataIn == '8') | (dataIn == '9')){
-				zBuffer = (dataIn - '0') + zBuffer*10;
-			}
-			else if(dataIn == '*'){ //Packet complete!
-				if(signState == NEGATIVE)
-				zBuffer = -(zBuffer);
-				signState = POSITIVE; //reset
-				;//printf("Read Z: %f thou\n", zBuffer);
-				dataState = NEW_DATA; 
-				parseState = WATCH_BEGIN;
-				
-				
-				
-			}
-			else if(dataIn == '-'){
-				signState = NEGATIVE;
-			}
-			else{
-				;//printf("\nbad Data\n");
-				parseState = WATCH_BEGIN;
-			}
+		case CMD_WAYPOINTS:
+			enqueueWaypoints(f);
 			break;
-		case CONFIRM_DATA: //OUTDATED
-			if(dataIn == 'y'){
-				
-			}else{
-				
+		case CMD_BEZIER:
+			enqueueBezier(f);
+			break;
+		case CMD_ARC:
+			enqueueArc(f);
+			break;
+		case CMD_STATS:
+			sendStats();
+			if(f->length == 1 && f->payload[0])
+				schedulerClearStats();
+			break;
+		case CMD_RATE:
+			if(f->length != 2)
+				break;
+			schedulerStart((uint16_t) frameGetInt16(f, 0), servoTick);
+			break;
+		case CMD_LIMITS:
+			if(f->length != 5)
+				break;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE){ // servoTick reads them
+				motionSetLimits((uint16_t) frameGetInt16(f, 0)/1000., (uint16_t) frameGetInt16(f, 2)/1000., f->payload[4]);
 			}
-		
+			break;
+		case CMD_TELEMETRY:
+			if(f->length != 2)
+				break;
+			telemetrySetRate((uint16_t) frameGetInt16(f, 0));
+			break;
+		case CMD_TRACE:
+			traceDump(f->length == 1 && f->payload[0]);
+			break;
+		case CMD_GCODE:
+			if(f->length != 1)
+				break;
+			gcodeMode = f->payload[0];
+			gcodeDiscardLine(&gcodeInterp);
+			break;
+		case CMD_BAUD:
+			changeBaud(f);
+			return; // A credit now would go out at the rate the host has not switched to
 	}
+	creditDue = 1;
+}
+
+// Answer a CMD_BAUD frame and switch to the rate asked for, if the divisor
+// comes within LINK_MAX_ERROR of it. Until checkBaud sees a frame at the new
+// rate, it can go back to the old one.
+void changeBaud(struct frame* f){
+	struct frame reply;
+	unsigned char out[FRAME_MAX_ENCODED + 2];
+	long baud, actual;
 	
-	return parseError;
+	if(f->length != 4)
+		return;
+	baud = (long) (uint16_t) frameGetInt16(f, 0) | (long) frameGetInt16(f, 2) << 16;
+	actual = 0;
+	if(baud >= LINK_DEFAULT_BAUD && baud <= LINK_MAX_BAUD){
+		actual = 2000000L / ((2000000L + baud/2) / baud);
+		if(labs(actual - baud) * 1000 > baud * LINK_MAX_ERROR)
+			actual = 0;
+	}
+	reply.command = CMD_BAUD;
+	reply.sequence = expectedSequence - 1;
+	reply.length = 4;
+	framePutInt16(&reply, 0, (int16_t) (actual ? baud : 0));
+	framePutInt16(&reply, 2, (int16_t) ((actual ? baud : 0) >> 16));
+	serial_write(out, frameEncode(&reply, out));
+	if(!actual || baud == linkBaud)
+		return;
+	serial_set_baudrate(baud); // Waits for the reply to go out first
+	linkFallback = linkBaud;
+	linkBaud = baud;
+	linkDeadline = schedulerTime() + LINK_CONFIRM_MS * 1000L;
 }
 
-// Print communication result
-void PrintCommStatus(int CommStatus)
-{
-	switch(CommStatus)
-	{
-		case COMM_TXFAIL:
-		;//printf("COMM_TXFAIL: Failed transmit instruction packet!\n");
-		break;
+// Go back to the old baud rate if no frame came at the new one in time.
+void checkBaud(void){
+	if((int32_t) (schedulerTime() - linkDeadline) < 0)
+		return;
+	serial_set_baudrate(linkFallback);
+	linkBaud = linkFallback;
+	linkFallback = 0;
+}
+
+// Report the servo tick timing and the error counters to the host.
+void sendStats(void){
+	struct frame f;
+	struct schedStats stats;
+	unsigned char out[FRAME_MAX_ENCODED + 2];
+	
+	schedulerGetStats(&stats);
+	f.command = CMD_STATS;
+	f.sequence = expectedSequence - 1;
+	f.length = 20;
+	framePutInt16(&f, 0, stats.rate);
+	framePutInt16(&f, 2, stats.ticks);
+	framePutInt16(&f, 4, stats.overruns);
+	framePutInt16(&f, 6, stats.maxLatency);
+	framePutInt16(&f, 8, stats.maxDuration);
+	framePutInt16(&f, 10, stats.lastDuration);
+	framePutInt16(&f, 12, frameErrors);
+	framePutInt16(&f, 14, queueOverflows);
+	framePutInt16(&f, 16, logDropped());
+	framePutInt16(&f, 18, goalWaits);
+	serial_write(out, frameEncode(&f, out));
+}
+
+// Tell the host how many setpoints it may send. The sequence acknowledges the
+// last frame received, so the host can discount frames still in flight.
+void sendCredit(void){
+	struct frame f;
+	unsigned char out[FRAME_MAX_ENCODED + 2];
+	
+	f.command = CMD_CREDIT;
+	f.sequence = expectedSequence - 1;
+	f.length = 1;
+	f.payload[0] = queueFree();
+	serial_write(out, frameEncode(&f, out));
+	reportedFree = f.payload[0];
+	creditDue = 0;
+}
+
+// Send a telemetry sample, with the position the servos are actually at,
+// solved from their present ticks. Starting from the last solution, the
+// solver takes one or two steps, so this stays cheap at high rates.
+void sendTelemetry(struct telemetry* t){
+	struct frame f;
+	unsigned char out[FRAME_MAX_ENCODED + 2];
+	double angles[3];
+	int i, length;
+	
+	f.command = CMD_TELEMETRY;
+	f.sequence = telemetrySequence++;
+	f.length = 27;
+	framePutInt16(&f, 0, (int16_t) t->time);
+	framePutInt16(&f, 2, (int16_t) (t->time >> 16));
+	for(i = 0; i < TELEMETRY_SERVOS; i++){
+		framePutInt16(&f, 4 + 2*i, t->ticks[i]);
+		framePutInt16(&f, 10 + 2*i, t->load[i]);
+		f.payload[16 + i] = t->temperature[i];
+		angles[i] = t->ticks[i]/TICKS_PER_DEGREE;
+	}
+	if(!measuredValid){
+		measuredPoint.x = 0;
+		measuredPoint.y = 0;
+		measuredPoint.z = MOTION_HOME_Z;
+	}
+	measuredValid = !t->errors && lookupPoint(INVERSE_TABLE, angles, &measuredPoint);
+	if(measuredValid){
+		framePutInt16(&f, 19, floor(measuredPoint.x*1000 + 0.5));
+		framePutInt16(&f, 21, floor(measuredPoint.y*1000 + 0.5));
+		framePutInt16(&f, 23, floor(measuredPoint.z*1000 + 0.5));
+	}
+	else{
+		for(i = 19; i < 25; i += 2)
+			framePutInt16(&f, i, INT16_MIN);
+	}
+	f.payload[25] = queueCount();
+	f.payload[26] = t->errors;
+	length = frameEncode(&f, out);
+	if(serial_get_txfree() >= length) // A late sample is dropped, not waited for
+		serial_write(out, length);
+}
 
-		case COMM_TXERROR:
-		;//printf("COMM_TXERROR: Incorrect instruction packet!\n");
-		break;
+// Append a setpoint to the queue. Dropped (and counted) if the queue is full,
+// which only happens if the host ignores its credit.
+void enqueue(unsigned char type, int16_t v1, int16_t v2, int16_t v3, uint16_t param){
+	struct setpoint s;
+	
+	s.type = type;
+	s.values[0] = v1;
+	s.values[1] = v2;
+	s.values[2] = v3;
+	s.param = param;
+	s.exit = 0;
+	if(queuePush(&s))
+		plannerQueued(&s, 1);
+	else{
+		queueOverflows++;
+		plannerReset(); // The planner no longer knows where the robot will be
+	}
+}
 
-		case COMM_RXFAIL:
-		;//printf("COMM_RXFAIL: Failed get status packet from device!\n");
-		break;
+// Queue the waypoints of a CMD_WAYPOINTS frame, all or none.
+void enqueueWaypoints(struct frame* f){
+	struct setpoint s[WAYPOINTS_MAX];
+	unsigned char n = f->length / WAYPOINT_SIZE;
+	unsigned char i;
+	
+	if(n == 0 || f->length != n * WAYPOINT_SIZE)
+		return;
+	for(i = 0; i < n; i++){
+		s[i].type = SETPOINT_POSITION;
+		s[i].values[0] = frameGetInt16(f, i*WAYPOINT_SIZE);
+		s[i].values[1] = frameGetInt16(f, i*WAYPOINT_SIZE + 2);
+		s[i].values[2] = frameGetInt16(f, i*WAYPOINT_SIZE + 4);
+		s[i].param = (uint16_t) frameGetInt16(f, i*WAYPOINT_SIZE + 6);
+		s[i].exit = 0;
+	}
+	if(queuePushBlock(s, n))
+		plannerQueued(s, n);
+	else{
+		queueOverflows += n;
+		plannerReset();
+	}
+}
 
-		case COMM_RXWAITING:
-		;//printf("COMM_RXWAITING: Now recieving status packet!\n");
-		break;
+// Queue a CMD_BEZIER frame as its two control points and the curve itself,
+// all or none.
+void enqueueBezier(struct frame* f){
+	struct setpoint s[3];
+	unsigned char i;
+	
+	if(f->length != 20)
+		return;
+	for(i = 0; i < 3; i++){
+		s[i].type = (i < 2) ? SETPOINT_CONTROL : SETPOINT_BEZIER;
+		s[i].values[0] = frameGetInt16(f, i*6);
+		s[i].values[1] = frameGetInt16(f, i*6 + 2);
+		s[i].values[2] = frameGetInt16(f, i*6 + 4);
+		s[i].param = 0;
+		s[i].exit = 0;
+	}
+	s[2].param = (uint16_t) frameGetInt16(f, 18);
+	if(queuePushBlock(s, 3))
+		plannerQueued(s, 3);
+	else{
+		queueOverflows += 3;
+		plannerReset();
+	}
+}
 
-		case COMM_RXTIMEOUT:
-		;//printf("COMM_RXTIMEOUT: There is no status packet!\n");
-		break;
+// Queue a CMD_ARC frame as its centre and the arc itself, all or none.
+void enqueueArc(struct frame* f){
+	struct setpoint s[2];
+	
+	if(f->length != 13)
+		return;
+	s[0].type = SETPOINT_CONTROL;
+	s[0].values[0] = frameGetInt16(f, 0);
+	s[0].values[1] = frameGetInt16(f, 2);
+	s[0].values[2] = 0;
+	s[0].param = 0;
+	s[0].exit = 0;
+	s[1].type = f->payload[12] ? SETPOINT_ARC_CCW : SETPOINT_ARC_CW;
+	s[1].values[0] = frameGetInt16(f, 4);
+	s[1].values[1] = frameGetInt16(f, 6);
+	s[1].values[2] = frameGetInt16(f, 8);
+	s[1].param = (uint16_t) frameGetInt16(f, 10);
+	s[1].exit = 0;
+	if(queuePushBlock(s, 2))
+		plannerQueued(s, 2);
+	else{
+		queueOverflows += 2;
+		plannerReset();
+	}
+}
 
-		case COMM_RXCORRUPT:
-		;//printf("COMM_RXCORRUPT: Incorrect status packet!\n");
-		break;
+// Fixed-rate control tick, called from the timer interrupt: write the next
+// goals, then read back the servos when a telemetry sample is due.
+void servoTick(void){
+	traceEvent(TRACE_TICK_START, 0);
+	stepSetpoints();
+	telemetryTick();
+	traceEvent(TRACE_TICK_END, 0);
+}
 
-		default:
-		;//printf("This is unknown error code!\n");
-		break;
+// Step the segment in progress, or once the current setpoint's duration is
+// over, move to the next queued one, if any. Leftover time carries over, so
+// durations that are not whole ticks average out. Segments time themselves
+// and leave holdTime at 0, so only a timed setpoint is counted down.
+void stepSetpoints(void){
+	struct setpoint s;
+	struct point p;
+	
+	if(motionNext(&p)){
+		moveToPoint(p);
+		return;
+	}
+	if(holdTime != 0){
+		holdTime -= schedulerPeriod();
+		if(holdTime > 0)
+			return;
 	}
+	// Control points are taken along with the segment they belong to
+	do{
+		if(!queuePop(&s)){
+			holdTime = 0;
+			return;
+		}
+		runSetpoint(&s);
+	}while(s.type == SETPOINT_CONTROL);
 }
 
-// Print error bit of status packet
-void PrintErrorCode()
-{
-	if(dxl_get_rxpacket_error(ERRBIT_VOLTAGE) == 1)
-	;//printf("Input voltage error!\n");
+// Move the servos to a setpoint popped from the queue.
+void runSetpoint(struct setpoint* s){
+	struct point p;
+	
+	switch(s->type){
+		case SETPOINT_POSITION:
+			p.x = s->values[0]/1000.;
+			p.y = s->values[1]/1000.;
+			p.z = s->values[2]/1000.;
+			motionSetPosition(p);
+			moveToPoint(p);
+			holdTime += (int32_t) s->param * 1000;
+			break;
+		case SETPOINT_TICKS:
+			motionForgetPosition();
+			writeGoalTicks((unsigned short) s->values[0], (unsigned short) s->values[1], (unsigned short) s->values[2]);
+			holdTime += (int32_t) s->param * 1000;
+			break;
+		case SETPOINT_CONTROL:
+			motionControl(s);
+			break;
+		case SETPOINT_LINE: // First sub-step now, the rest on the next ticks
+		case SETPOINT_ARC_CW:
+		case SETPOINT_ARC_CCW:
+		case SETPOINT_BEZIER:
+			holdTime = 0;
+			motionBegin(s, schedulerPeriod());
+			if(motionNext(&p))
+				moveToPoint(p);
+			break;
+	}
+}
 
-	if(dxl_get_rxpacket_error(ERRBIT_ANGLE) == 1)
-	;//printf("Angle limit error!\n");
+// Clamp 'p' onto the workspace and move there. Returns 0 if there is no
+// kinematic solution.
+int moveToPoint(struct point p){
+	double angles[3];
+	
+	p = projectToWorkspace(p);
+	if (!pointValid(p))
+		return 0;
+	traceEvent(TRACE_IK_START, 0);
+	lookupAngles(INVERSE_TABLE, angles, p);
+	traceEvent(TRACE_IK_END, 0);
+	if (isnan(angles[0]))
+		return 0;
+	writeGoalAngles(angles);
+	return 1;
+}
 
-	if(dxl_get_rxpacket_error(ERRBIT_OVERHEAT) == 1)
-	;//printf("Overheat error!\n");
+// Write goal positions given in degrees (servo coordinates).
+void writeGoalAngles(double angles[3]){
+	writeGoalTicks((int) (angles[0]*TICKS_PER_DEGREE), (int) (angles[1]*TICKS_PER_DEGREE), (int) (angles[2]*TICKS_PER_DEGREE));
+}
 
-	if(dxl_get_rxpacket_error(ERRBIT_RANGE) == 1)
-	;//printf("Out of range error!\n");
+// Write goal positions given in servo ticks, to all three servos in one
+// sync write packet, so the arms start together and no servo replies. The
+// packet goes out from the USART interrupts while the caller moves on, so
+// the next kinematics overlap it; only a previous write still on the bus
+// is waited for. Telemetry reads queued ahead can fill the bus queue; they
+// end on their own, so the goals wait for room, counted in goalWaits,
+// rather than being dropped.
+void writeGoalTicks(int ticks1, int ticks2, int ticks3){
+	int ids[3] = {1, 2, 3};
+	int ticks[3];
+	
+	ticks[0] = ticks1;
+	ticks[1] = ticks2;
+	ticks[2] = ticks3;
+	while(goalWrite.result == COMM_RXWAITING);
+	if(dxl_async_sync_write_words( &goalWrite, P_GOAL_POSITION_L, ids, ticks, 3 ))
+		return;
+	goalWaits++;
+	while(goalWrite.result != COMM_TXERROR
+		&& !dxl_async_sync_write_words( &goalWrite, P_GOAL_POSITION_L, ids, ticks, 3 ));
+}
 
-	if(dxl_get_rxpacket_error(ERRBIT_CHECKSUM) == 1)
-	;//printf("Checksum error!\n");
+// Feed one byte of the ASCII protocol to the parser and update dataState.
+// Returns nonzero if a malformed command was dropped.
+int parseAll(char dataIn){
+	switch (parserFeed(&asciiParser, dataIn)){
+		case PARSE_POSITION:
+			positionDataType = POSITION;
+			dataState = NEW_DATA;
+			break;
+		case PARSE_ANGLE:
+			positionDataType = ANGLE;
+			dataState = NEW_DATA;
+			break;
+		case PARSE_OTHER:
+			if((dataIn == 'y') && (dataState == CONFIRM_DATA)){
+				dataState = SEND_DATA;
+			}
+			else if((dataIn == 'n') && (dataState == NEW_DATA)){
+				LOG_DEBUG(LOG_ABORT_SEND);
+				dataState = OLD_DATA;
+			}
+			else{
+				dataState = OLD_DATA;
+				// In G-code mode, anything else outside of a '$' or '%'
+				// command is G-code; otherwise stray bytes are ignored
+				if(gcodeMode && gcodeFeed(&gcodeInterp, dataIn) == GCODE_READY)
+					gcodePending = 1;
+			}
+			break;
+		case PARSE_ERROR:
+			LOG(LOG_BAD_DATA);
+			return 1;
+	}
+	
+	return 0;
+}
+
+// Returns nonzero if all three goal positions are within 0 to MAX_TICKS, so
+// they fit the queue's int16_t and mean what the host asked for.
+int ticksValid(int32_t ticks[3]){
+	unsigned char i;
+	
+	for(i = 0; i < 3; i++)
+		if(ticks[i] < 0 || ticks[i] > MAX_TICKS)
+			return 0;
+	return 1;
+}
 
-	if(dxl_get_rxpacket_error(ERRBIT_OVERLOAD) == 1)
-	;//printf("Overload error!\n");
+// Log communication result
+void PrintCommStatus(int CommStatus)
+{
+	if(CommStatus != COMM_TXSUCCESS && CommStatus != COMM_RXSUCCESS)
+		LOG(LOG_COMM_STATUS, CommStatus);
+}
 
-	if(dxl_get_rxpacket_error(ERRBIT_INSTRUCTION) == 1)
-	;//printf("Instruction code error!\n");
+// Log error bits of status packet
+void PrintErrorCode()
+{
+	unsigned char errors = 0;
+	unsigned char bit;
+	
+	for(bit = ERRBIT_VOLTAGE; bit <= ERRBIT_INSTRUCTION; bit <<= 1)
+		if(dxl_get_rxpacket_error(bit) == 1)
+			errors |= bit;
+	if(errors)
+		LOG(LOG_SERVO_ERROR, errors);
 }
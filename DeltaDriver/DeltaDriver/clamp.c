@@ -0,0 +1,209 @@
+#include <math.h>
+#include "clamp.h"
+
+/**
+ * Implements batched workspace clamping of host-side paths for a delta robot.
+ * Mirrors boundDestination and restrainMove in Python/workspace.py and
+ * Python/controller.py. Arrays of points are flat arrays of doubles laid out
+ * (x0, y0, z0, x1, y1, z1, ...), as in a C-contiguous numpy array of shape
+ * (n, 3).
+ */
+
+/**
+ * Home position of mechanism.
+ */
+static const struct point HOME = {0, 0, -8.5064};
+
+/**
+ * Returns 1 if the point 'p' when projected on the xy-plane falls in the
+ * paper rectangle; 0 otherwise.
+ */
+static int inRectangle(struct point p)
+{
+    return fabs(p.x) <= X_RCT_MAX && fabs(p.y) <= Y_RCT_MAX;
+}
+
+/**
+ * Returns the point 'p' stored at index 'i' of the flat array 'points'.
+ */
+static struct point pointAt(const double* points, int i)
+{
+    struct point p;
+    p.x = points[3 * i];
+    p.y = points[3 * i + 1];
+    p.z = points[3 * i + 2];
+    return p;
+}
+
+/**
+ * Stores the point 'p' at index 'i' of the flat array 'points'.
+ */
+static void storePoint(double* points, int i, struct point p)
+{
+    points[3 * i] = p.x;
+    points[3 * i + 1] = p.y;
+    points[3 * i + 2] = p.z;
+}
+
+/**
+ * Returns a point that limits the point 'pEnd' to the boundary of the pen
+ * workspace, reachable by a straight move from 'pStart'. Out-of-bounds points
+ * are projected with projectToWorkspace. A pen outside the paper rectangle may
+ * not drop below the clamps, and a pen below the clamps may not leave the
+ * rectangle. An invalid 'pStart' sends the point to home.
+ */
+struct point boundDestination(struct point pStart, struct point pEnd)
+{
+    struct point out;
+
+    if (!penPointValid(pStart))
+        return HOME;
+
+    out = penPointValid(pEnd) ? pEnd : projectToWorkspace(pEnd);
+
+    if (!inRectangle(pStart))
+    {
+        if (out.z < Z_PEN_CLAMP)
+            out.z = Z_PEN_CLAMP;
+    }
+    else if (pStart.z < Z_PEN_CLAMP)
+    {
+        out.x = fmin(fmax(out.x, -X_RCT_MAX), X_RCT_MAX);
+        out.y = fmin(fmax(out.y, -Y_RCT_MAX), Y_RCT_MAX);
+    }
+    return out;
+}
+
+/**
+ * Returns 'pEnd' if it is within 'restrainThresh' of 'pStart'. Otherwise,
+ * returns the point 'restrainDist' from 'pStart' in the direction of 'pEnd'.
+ */
+struct point restrainMove(struct point pStart, struct point pEnd,
+                          double restrainThresh, double restrainDist)
+{
+    double dx = pEnd.x - pStart.x;
+    double dy = pEnd.y - pStart.y;
+    double dz = pEnd.z - pStart.z;
+    double dist = sqrt(dx * dx + dy * dy + dz * dz);
+
+    if (dist <= restrainThresh)
+        return pEnd;
+
+    pStart.x += restrainDist * dx / dist;
+    pStart.y += restrainDist * dy / dist;
+    pStart.z += restrainDist * dz / dist;
+    return pStart;
+}
+
+/**
+ * Bounds each of the 'n' points in 'ends' with boundDestination, moving from
+ * the matching point of the 'n' points in 'start', and stores the results in
+ * 'out'.
+ */
+void boundPoints(const double* start, const double* ends, double* out, int n)
+{
+    int i;
+    for (i = 0; i < n; i++)
+        storePoint(out, i, boundDestination(pointAt(start, i),
+                                            pointAt(ends, i)));
+}
+
+/**
+ * Clamps the 'n' desired positions in 'path' the way the tracking loop does:
+ * each one is bounded and restrained from the previous output, starting from
+ * the point 'start'. Stores the positions to send in 'out', which may alias
+ * 'path'.
+ */
+void clampPath(const double* path, double* out, int n, const double* start,
+               double restrainThresh, double restrainDist)
+{
+    struct point current = pointAt(start, 0);
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        struct point bounded = boundDestination(current, pointAt(path, i));
+        current = restrainMove(current, bounded, restrainThresh, restrainDist);
+        storePoint(out, i, current);
+    }
+}
+
+/**
+ * Returns 1 if the pen stays within the pen workspace along the whole straight
+ * move between the valid points 'a' and 'b'; 0 otherwise. Both pieces of the
+ * workspace are convex, so the move is split where it crosses the clamp
+ * height: the part above it lies in the cylinder, and the part below it must
+ * start and end inside the paper rectangle.
+ */
+int segmentValid(struct point a, struct point b)
+{
+    if (a.z >= Z_PEN_CLAMP && b.z >= Z_PEN_CLAMP)
+        return 1;
+    if (a.z < Z_PEN_CLAMP && b.z < Z_PEN_CLAMP)
+        return 1; /* Both in the prism. */
+
+    /* Point where the move crosses the clamp height. */
+    double t = (Z_PEN_CLAMP - a.z) / (b.z - a.z);
+    struct point c;
+    c.x = a.x + t * (b.x - a.x);
+    c.y = a.y + t * (b.y - a.y);
+    c.z = Z_PEN_CLAMP;
+    return inRectangle(c);
+}
+
+/**
+ * Checks each of the 'n' - 1 moves of 'path', storing 1 in 'valid' for a move
+ * whose endpoints are valid and that passes segmentValid, and 0 otherwise.
+ */
+void checkSegments(const double* path, int n, unsigned char* valid)
+{
+    struct point a;
+    struct point b;
+    int i;
+    for (i = 0; i + 1 < n; i++)
+    {
+        a = pointAt(path, i);
+        b = pointAt(path, i + 1);
+        valid[i] = penPointValid(a) && penPointValid(b) && segmentValid(a, b);
+    }
+}
+
+/**
+ * Copies the 'n' points of 'path' into 'out', projecting invalid points onto
+ * the workspace and splitting moves that cut through the clamps: the pen first
+ * rises to the clamp height, crosses over, and then drops down. 'out' must
+ * have room for 3 * 'n' points. Returns the number of points stored.
+ */
+int splitPath(const double* path, int n, double* out)
+{
+    struct point previous;
+    struct point current;
+    struct point via;
+    int count = 0;
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        current = pointAt(path, i);
+        if (!penPointValid(current))
+            current = projectToWorkspace(current);
+
+        if (i > 0 && !segmentValid(previous, current))
+        {
+            if (previous.z < Z_PEN_CLAMP)
+            {
+                via = previous;
+                via.z = Z_PEN_CLAMP;
+                storePoint(out, count++, via);
+            }
+            if (current.z < Z_PEN_CLAMP)
+            {
+                via = current;
+                via.z = Z_PEN_CLAMP;
+                storePoint(out, count++, via);
+            }
+        }
+        storePoint(out, count++, current);
+        previous = current;
+    }
+    return count;
+}
@@ -0,0 +1,23 @@
+/**
+ * Implements batched workspace clamping of host-side paths for a delta robot.
+ */
+
+#ifndef __CLAMP_H
+#define __CLAMP_H
+
+#include "workspace.h"
+
+/**
+ * Functions.
+ */
+struct point boundDestination(struct point pStart, struct point pEnd);
+struct point restrainMove(struct point pStart, struct point pEnd,
+                          double restrainThresh, double restrainDist);
+void boundPoints(const double* start, const double* ends, double* out, int n);
+void clampPath(const double* path, double* out, int n, const double* start,
+               double restrainThresh, double restrainDist);
+int segmentValid(struct point a, struct point b);
+void checkSegments(const double* path, int n, unsigned char* valid);
+int splitPath(const double* path, int n, double* out);
+
+#endif /* CLAMP_H */
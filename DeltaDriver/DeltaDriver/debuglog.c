@@ -0,0 +1,96 @@
+#include <avr/pgmspace.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include "serial.h"
+#include "protocol.h"
+#include "debuglog.h"
+
+/**
+ * Implements the tokenized log. A message goes out as a CMD_LOG frame with
+ * its ID and its arguments packed as its signature says; the format strings
+ * stay on the host, so a message costs a few bytes of flash and no printf.
+ */
+
+#define LOG_MESSAGE(id, signature, format) signature,
+static const char signatures[LOG_MESSAGES][LOG_MAX_ARGS + 1] PROGMEM =
+{
+#include "logmessages.h"
+};
+#undef LOG_MESSAGE
+
+static uint8_t sequence = 0;            /* Counts CMD_LOG frames sent. */
+static uint16_t dropped = 0;            /* Messages the TX buffer had no
+                                           room for. */
+
+/**
+ * Sends the message 'id' with the arguments its signature lists, as passed
+ * to printf: integers as int or long, floats as double.
+ */
+void logSend(int id, ...)
+{
+    struct frame f;
+    uint8_t out[FRAME_MAX_ENCODED + 2];
+    const char* code;
+    va_list args;
+    int32_t value;
+    union
+    {
+        float f;
+        int32_t i;
+    } real;
+    uint8_t size;
+    int length;
+
+    if (id < 0 || id >= LOG_MESSAGES)
+        return;
+    f.command = CMD_LOG;
+    f.sequence = sequence++;
+    f.payload[0] = id;
+    f.length = 1;
+    va_start(args, id);
+    for (code = signatures[id]; pgm_read_byte(code); code++)
+    {
+        switch (pgm_read_byte(code))
+        {
+            case 'b':
+            case 'B':
+                value = va_arg(args, int);
+                size = 1;
+                break;
+            case 'h':
+            case 'H':
+                value = va_arg(args, int);
+                size = 2;
+                break;
+            case 'f':
+                real.f = (float) va_arg(args, double);
+                value = real.i;
+                size = 4;
+                break;
+            default: /* 'l' or 'L' */
+                value = va_arg(args, long);
+                size = 4;
+                break;
+        }
+        while (size--)
+        {
+            f.payload[f.length++] = (uint8_t) value;
+            value >>= 8;
+        }
+    }
+    va_end(args);
+
+    length = frameEncode(&f, out);
+    if (serial_get_txfree() >= length)
+        serial_write(out, length);
+    else
+        dropped++;
+}
+
+/**
+ * Returns the number of messages dropped for lack of room so far.
+ */
+uint16_t logDropped(void)
+{
+    return dropped;
+}
@@ -0,0 +1,54 @@
+/**
+ * Implements the tokenized log: messages are sent to the host as an ID and
+ * their raw arguments, and Python/logdecode.py formats them.
+ */
+
+#ifndef __DEBUGLOG_H
+#define __DEBUGLOG_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** LOG SPECS. */
+/* LOG() is for errors and LOG_DEBUG() for step-by-step diagnostics, such as
+   the ASCII path's echo of every setpoint. Calls above LOG_LEVEL compile to
+   nothing; at the default, a good ASCII command logs nothing, so the log
+   keeps within the serial TX buffer at 57600 baud. A message that does not
+   fit in the buffer is dropped, never waited for. */
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_DEBUG     2
+#define LOG_LEVEL           LOG_LEVEL_ERROR
+#define LOG_MAX_ARGS        4     /* Arguments per message. */
+
+/** MESSAGE IDS. */
+#define LOG_MESSAGE(id, signature, format) id,
+enum logId
+{
+#include "logmessages.h"
+    LOG_MESSAGES
+};
+#undef LOG_MESSAGE
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG(...)            logSend(__VA_ARGS__)
+#else
+#define LOG(...)            ((void) 0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...)      logSend(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...)      ((void) 0)
+#endif
+
+/**
+ * Functions.
+ */
+void logSend(int id, ...);
+uint16_t logDropped(void);
+
+#endif /* DEBUGLOG_H */
@@ -751,6 +751,86 @@ void lookupAngles(double inverseTable[X_TABLE_DIM][Y_TABLE_DIM][Z_TABLE_DIM][3],
     }
 }
 
+/**
+ * Determines the point at which servo actuators 1, 2, and 3 are at 'angles'
+ * (in degrees & in servo coordinates) by inverting lookupAngles with Newton's
+ * method, starting from the estimate in 'p', and stores the result in 'p'.
+ * The Jacobian is taken numerically, FK_STEP apart. Returns 1 once the angles
+ * at 'p' are within FK_TOLERANCE of 'angles', and 0 if they are not within
+ * FK_MAX_ITERATIONS or 'p' leaves the table.
+ */
+int lookupPoint(double inverseTable[X_TABLE_DIM][Y_TABLE_DIM][Z_TABLE_DIM][3],
+                double* angles, struct point* p)
+{
+    double f[3];            /* Angles at 'p' less the goal. */
+    double jacobian[3][3];  /* d angle[row] / d axis[column]. */
+    double g[3];
+    double det;
+    struct point q;
+    int iteration;
+    int i;
+    int axis;
+
+    for (iteration = 0; iteration <= FK_MAX_ITERATIONS; iteration++)
+    {
+        lookupAngles(inverseTable, f, *p);
+        if (isnan(f[0]))
+            return 0;
+        for (i = 0; i < 3; i++)
+            f[i] -= angles[i];
+        if (fabs(f[0]) < FK_TOLERANCE && fabs(f[1]) < FK_TOLERANCE &&
+            fabs(f[2]) < FK_TOLERANCE)
+            return 1;
+        if (iteration == FK_MAX_ITERATIONS)
+            break;
+
+        for (axis = 0; axis < 3; axis++)
+        {
+            q = *p;
+            if (axis == 0)
+                q.x += FK_STEP;
+            else if (axis == 1)
+                q.y += FK_STEP;
+            else
+                q.z += FK_STEP;
+            lookupAngles(inverseTable, g, q);
+            if (isnan(g[0]))
+                return 0;
+            for (i = 0; i < 3; i++)
+                jacobian[i][axis] = (g[i] - angles[i] - f[i]) / FK_STEP;
+        }
+
+        /* Solve jacobian * step = f by Cramer's rule, and step back. */
+        det = jacobian[0][0] * (jacobian[1][1] * jacobian[2][2] -
+                                jacobian[1][2] * jacobian[2][1]) -
+              jacobian[0][1] * (jacobian[1][0] * jacobian[2][2] -
+                                jacobian[1][2] * jacobian[2][0]) +
+              jacobian[0][2] * (jacobian[1][0] * jacobian[2][1] -
+                                jacobian[1][1] * jacobian[2][0]);
+        if (fabs(det) < DBL_MIN)
+            return 0;
+        p->x -= (f[0] * (jacobian[1][1] * jacobian[2][2] -
+                         jacobian[1][2] * jacobian[2][1]) -
+                 jacobian[0][1] * (f[1] * jacobian[2][2] -
+                                   jacobian[1][2] * f[2]) +
+                 jacobian[0][2] * (f[1] * jacobian[2][1] -
+                                   jacobian[1][1] * f[2])) / det;
+        p->y -= (jacobian[0][0] * (f[1] * jacobian[2][2] -
+                                   jacobian[1][2] * f[2]) -
+                 f[0] * (jacobian[1][0] * jacobian[2][2] -
+                         jacobian[1][2] * jacobian[2][0]) +
+                 jacobian[0][2] * (jacobian[1][0] * f[2] -
+                                   f[1] * jacobian[2][0])) / det;
+        p->z -= (jacobian[0][0] * (jacobian[1][1] * f[2] -
+                                   f[1] * jacobian[2][1]) -
+                 jacobian[0][1] * (jacobian[1][0] * f[2] -
+                                   f[1] * jacobian[2][0]) +
+                 f[0] * (jacobian[1][0] * jacobian[2][1] -
+                         jacobian[1][1] * jacobian[2][0])) / det;
+    }
+    return 0;
+}
+
 /**
  * Returns the coordinate on axis 'axis' ('x', 'y', or 'z') corresponding to
  * index 'index' from the lookup table.
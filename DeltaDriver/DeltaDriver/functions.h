@@ -37,6 +37,12 @@
 #define Y_TABLE_DIM  (int) ((Y_TABLE_MAX - Y_TABLE_MIN) / Y_TABLE_RES + 1)
 #define Z_TABLE_DIM  (int) ((Z_TABLE_MAX - Z_TABLE_MIN) / Z_TABLE_RES + 1)
 
+/** FORWARD KINEMATICS. */
+/* lookupPoint inverts lookupAngles numerically. */
+#define FK_STEP        0.01   /* Inches between points of the Jacobian. */
+#define FK_TOLERANCE   0.05   /* Degrees, about half a servo tick. */
+#define FK_MAX_ITERATIONS 4   /* Newton steps from the estimate. */
+
 
 /**
  * Represents a point in 3D.
@@ -66,6 +72,8 @@ void writeInverseTable(double inverseTable[X_TABLE_DIM]
                        [Y_TABLE_DIM][Z_TABLE_DIM][3]);
 void lookupAngles(double inverseTable[X_TABLE_DIM][Y_TABLE_DIM][Z_TABLE_DIM][3],
                   double* angles, struct point p);
+int lookupPoint(double inverseTable[X_TABLE_DIM][Y_TABLE_DIM][Z_TABLE_DIM][3],
+                double* angles, struct point* p);
 double indexToPoint(char axis, int index);
 void printAngles(char indicator[], double angles[3]);
 int pointToIndex(char axis, double point);
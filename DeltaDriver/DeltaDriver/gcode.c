@@ -0,0 +1,472 @@
+#include <stdint.h>
+#include <math.h>
+#include "workspace.h"
+#include "queue.h"
+#include "motion.h"
+#include "planner.h"
+#include "gcode.h"
+
+/**
+ * Implements the streaming G-code interpreter. Bytes are fed one at a time,
+ * and words are accumulated in fixed point as they arrive, so no line buffer
+ * is needed. At the end of a line its moves are worked out in thousandths of
+ * an inch, and gcodeRun queues them once there is room in the queue: a G0/G1
+ * is a line, and a G2/G3 an arc the robot interpolates itself. The planner
+ * joins them.
+ *
+ * The caller should not feed the next line until gcodeRun returns
+ * GCODE_DONE. The host counts the characters of the lines not yet
+ * acknowledged, so they always fit in the serial receive buffer meanwhile.
+ */
+
+/* States. */
+#define S_WORD      0   /* Between words: a letter or the end of the line. */
+#define S_NUMBER    1   /* After a letter: sign, digits and point. */
+#define S_COMMENT   2   /* In '(...)'. */
+#define S_SKIP      3   /* Rest of the line ignored: ';' or an error. */
+
+/* Work of a complete line. */
+#define WORK_NONE   0
+#define WORK_LINE   1
+#define WORK_ARC    2
+#define WORK_DWELL  3
+
+#define NO_DECIMALS 0xFF
+
+/**
+ * Starts a new line in 'gc'.
+ */
+static void beginLine(struct gcode* gc)
+{
+    gc->state = S_WORD;
+    gc->seen = 0;
+    gc->dwell = 0;
+    gc->error = GCODE_OK;
+}
+
+/**
+ * Resets 'gc' to millimetres, absolute coordinates, the robot at home and no
+ * work pending.
+ */
+void gcodeReset(struct gcode* gc)
+{
+    beginLine(gc);
+    gc->motion = 0;
+    gc->inches = 0;
+    gc->relative = 0;
+    gc->feed = 0;
+    gc->position[0] = 0;
+    gc->position[1] = 0;
+    gc->position[2] = (int32_t) (MOTION_HOME_Z * 1000);
+    gc->work = WORK_NONE;
+}
+
+/**
+ * Drops whatever 'gc' has read of the current line, keeping the modal state.
+ */
+void gcodeDiscardLine(struct gcode* gc)
+{
+    beginLine(gc);
+}
+
+/**
+ * Drops the rest of the line in 'gc' with 'error'.
+ */
+static void fail(struct gcode* gc, uint8_t error)
+{
+    if (gc->error == GCODE_OK)
+        gc->error = error;
+    gc->state = S_SKIP;
+}
+
+/**
+ * Applies the word just read in 'gc'.
+ */
+static void endWord(struct gcode* gc)
+{
+    int32_t value = gc->number;
+    uint8_t word;
+
+    if (gc->digits == 0)
+    {
+        fail(gc, GCODE_ERR_SYNTAX);
+        return;
+    }
+    if (gc->decimals == NO_DECIMALS)
+        gc->decimals = 0;
+    for (; gc->decimals < 4; gc->decimals++)
+        value *= 10;
+    if (gc->negative)
+        value = -value;
+    gc->state = S_WORD;
+
+    switch (gc->letter)
+    {
+        case 'G':
+            if (value % GCODE_SCALE != 0)
+            {
+                fail(gc, GCODE_ERR_WORD);
+                return;
+            }
+            switch (value / GCODE_SCALE)
+            {
+                case 0:
+                case 1:
+                case 2:
+                case 3:
+                    gc->motion = (uint8_t) (value / GCODE_SCALE);
+                    return;
+                case 4:
+                    gc->dwell = 1;
+                    return;
+                case 17: /* XY-plane, the only one. */
+                    return;
+                case 20:
+                case 21:
+                    gc->inches = (value / GCODE_SCALE == 20);
+                    return;
+                case 90:
+                case 91:
+                    gc->relative = (value / GCODE_SCALE == 91);
+                    return;
+            }
+            fail(gc, GCODE_ERR_WORD);
+            return;
+
+        case 'N': /* Line numbers, and machine, spindle and tool words. */
+        case 'M':
+        case 'S':
+        case 'T':
+            return;
+
+        case 'X': word = GW_X; break;
+        case 'Y': word = GW_Y; break;
+        case 'Z': word = GW_Z; break;
+        case 'I': word = GW_I; break;
+        case 'J': word = GW_J; break;
+        case 'R': word = GW_R; break;
+        case 'F': word = GW_F; break;
+        case 'P': word = GW_P; break;
+
+        default:
+            fail(gc, GCODE_ERR_WORD);
+            return;
+    }
+    gc->words[word] = value;
+    gc->seen |= 1 << word;
+}
+
+/**
+ * Returns 'value', in 1/GCODE_SCALE of the current unit, in thousandths of
+ * an inch, rounded.
+ */
+static int32_t toThou(const struct gcode* gc, int32_t value)
+{
+    int32_t divisor = gc->inches ? 10 : 254; /* 1 in = 25.4 mm. */
+
+    if (value < 0)
+        return -((-value + divisor / 2) / divisor);
+    return (value + divisor / 2) / divisor;
+}
+
+/**
+ * Finds the centre of the arc of the line in 'gc' from its position to its
+ * target. Returns 0 if the arc has no valid centre.
+ */
+static int planArc(struct gcode* gc)
+{
+    double sx = gc->position[0], sy = gc->position[1];
+    double ex = gc->target[0], ey = gc->target[1];
+    double cx, cy, r, h, d;
+
+    if (gc->seen & (1 << GW_R))
+    {
+        /* Centre on the bisector of the chord; a negative R is the long way
+           round. */
+        r = toThou(gc, gc->words[GW_R]);
+        d = sqrt((ex - sx) * (ex - sx) + (ey - sy) * (ey - sy));
+        if (d < 1 || fabs(r) < d / 2)
+            return 0;
+        h = sqrt(r * r - d * d / 4) / d;
+        if ((gc->motion == 2) == (r > 0))
+            h = -h;
+        cx = (sx + ex) / 2 - h * (ey - sy);
+        cy = (sy + ey) / 2 + h * (ex - sx);
+        r = fabs(r);
+    }
+    else if (gc->seen & ((1 << GW_I) | (1 << GW_J)))
+    {
+        cx = sx + ((gc->seen & (1 << GW_I)) ? toThou(gc, gc->words[GW_I]) : 0);
+        cy = sy + ((gc->seen & (1 << GW_J)) ? toThou(gc, gc->words[GW_J]) : 0);
+        r = sqrt((sx - cx) * (sx - cx) + (sy - cy) * (sy - cy));
+        d = sqrt((ex - cx) * (ex - cx) + (ey - cy) * (ey - cy));
+        if (fabs(r - d) > GCODE_ARC_TOLERANCE * 1000)
+            return 0; /* End not on the circle. */
+    }
+    else
+    {
+        return 0;
+    }
+    if (r < 1)
+        return 0;
+
+    gc->arcCentre[0] = (int32_t) floor(cx + 0.5);
+    gc->arcCentre[1] = (int32_t) floor(cy + 0.5);
+    return 1;
+}
+
+/**
+ * Works out the moves of the line just read in 'gc'.
+ */
+static void endLine(struct gcode* gc)
+{
+    int32_t value;
+    uint8_t i;
+
+    gc->work = WORK_NONE;
+    gc->result = gc->error;
+    if (gc->error != GCODE_OK)
+        return;
+
+    if (gc->seen & (1 << GW_F))
+    {
+        /* Per minute to thousandths of an inch per second. */
+        value = gc->words[GW_F] / (gc->inches ? 600 : 15240);
+        if (value < 0)
+            value = 0;
+        gc->feed = (value > UINT16_MAX) ? UINT16_MAX : (uint16_t) value;
+    }
+
+    if (gc->dwell)
+    {
+        value = (gc->seen & (1 << GW_P)) ? gc->words[GW_P] / 10 : 0;
+        if (value < 0)
+            value = 0;
+        gc->dwellMs = (value > UINT16_MAX) ? UINT16_MAX : (uint16_t) value;
+        gc->work = WORK_DWELL;
+        return;
+    }
+
+    if (!(gc->seen & ((1 << GW_X) | (1 << GW_Y) | (1 << GW_Z))))
+        return; /* Only modes or feed rate. */
+    for (i = 0; i < 3; i++)
+    {
+        gc->target[i] = gc->position[i];
+        if (!(gc->seen & (1 << i)))
+            continue;
+        value = toThou(gc, gc->words[i]);
+        if (gc->relative)
+            gc->target[i] += value;
+        else
+            gc->target[i] = value + ((i == GW_Z) ?
+                            (int32_t) (GCODE_ORIGIN_Z * 1000) : 0);
+    }
+
+    if (gc->motion < 2)
+        gc->work = WORK_LINE;
+    else if (planArc(gc))
+        gc->work = WORK_ARC;
+    else
+        gc->result = GCODE_ERR_ARC;
+}
+
+/**
+ * Feeds the byte 'dataIn' to the interpreter 'gc'. Returns GCODE_READY at
+ * the end of a line, and GCODE_NONE otherwise.
+ */
+int gcodeFeed(struct gcode* gc, char dataIn)
+{
+    char c = dataIn;
+
+    if (c >= 'a' && c <= 'z')
+        c -= 'a' - 'A';
+
+    if (c == '\n')
+    {
+        if (gc->state == S_NUMBER)
+            endWord(gc);
+        else if (gc->state == S_COMMENT)
+            fail(gc, GCODE_ERR_SYNTAX);
+        endLine(gc);
+        beginLine(gc);
+        return GCODE_READY;
+    }
+    if (c == '\r' || c == ' ' || c == '\t')
+        return GCODE_NONE;
+
+    switch (gc->state)
+    {
+        case S_COMMENT:
+            if (c == ')')
+                gc->state = S_WORD;
+            return GCODE_NONE;
+
+        case S_SKIP:
+            return GCODE_NONE;
+
+        case S_NUMBER:
+            if (c >= '0' && c <= '9')
+            {
+                if (gc->decimals == NO_DECIMALS)
+                {
+                    if (++gc->digits > GCODE_MAX_DIGITS)
+                        fail(gc, GCODE_ERR_SYNTAX);
+                }
+                else if (gc->decimals < 4)
+                {
+                    gc->decimals++;
+                }
+                else
+                {
+                    return GCODE_NONE; /* Past the resolution. */
+                }
+                gc->number = gc->number * 10 + (c - '0');
+                return GCODE_NONE;
+            }
+            if (c == '.' && gc->decimals == NO_DECIMALS)
+            {
+                gc->decimals = 0;
+                if (gc->digits == 0)
+                    gc->digits = 1; /* '.5' */
+                return GCODE_NONE;
+            }
+            if ((c == '-' || c == '+') && gc->digits == 0 &&
+                gc->decimals == NO_DECIMALS && !gc->negative)
+            {
+                gc->negative = (c == '-');
+                return GCODE_NONE;
+            }
+            endWord(gc);
+            if (gc->state != S_WORD)
+                return GCODE_NONE;
+            break; /* The byte starts the next word. */
+    }
+
+    if (c >= 'A' && c <= 'Z')
+    {
+        gc->state = S_NUMBER;
+        gc->letter = c;
+        gc->digits = 0;
+        gc->decimals = NO_DECIMALS;
+        gc->negative = 0;
+        gc->number = 0;
+    }
+    else if (c == '(')
+    {
+        gc->state = S_COMMENT;
+    }
+    else if (c == ';')
+    {
+        gc->state = S_SKIP;
+    }
+    else
+    {
+        fail(gc, GCODE_ERR_SYNTAX);
+    }
+    return GCODE_NONE;
+}
+
+/**
+ * Returns 'thou' clamped to a setpoint value.
+ */
+static int16_t toValue(int32_t thou)
+{
+    if (thou > INT16_MAX)
+        return INT16_MAX;
+    if (thou < INT16_MIN)
+        return INT16_MIN;
+    return (int16_t) thou;
+}
+
+/**
+ * Queues the line from the last queued point to 'p', in thousandths of an
+ * inch, at the current feed rate (the fastest for G0). Returns 0 if the
+ * queue is full.
+ */
+static int queueLine(struct gcode* gc, const int32_t p[3])
+{
+    struct setpoint s;
+    uint8_t i;
+
+    if (queueFree() == 0)
+        return 0;
+    s.type = SETPOINT_LINE;
+    for (i = 0; i < 3; i++)
+    {
+        gc->position[i] = p[i];
+        s.values[i] = toValue(p[i]);
+    }
+    s.param = (gc->motion == 0) ? 0 : gc->feed;
+    s.exit = 0;
+    queuePush(&s);
+    plannerQueued(&s, 1);
+    return 1;
+}
+
+/**
+ * Queues the arc of the last line of 'gc', its centre first. Returns 0 if
+ * the queue has no room for both.
+ */
+static int queueArc(struct gcode* gc)
+{
+    struct setpoint s[2];
+    uint8_t i;
+
+    if (queueFree() < 2)
+        return 0;
+    s[0].type = SETPOINT_CONTROL;
+    s[0].values[0] = toValue(gc->arcCentre[0]);
+    s[0].values[1] = toValue(gc->arcCentre[1]);
+    s[0].values[2] = 0;
+    s[0].param = 0;
+    s[0].exit = 0;
+    s[1].type = (gc->motion == 2) ? SETPOINT_ARC_CW : SETPOINT_ARC_CCW;
+    for (i = 0; i < 3; i++)
+    {
+        gc->position[i] = gc->target[i];
+        s[1].values[i] = toValue(gc->target[i]);
+    }
+    s[1].param = gc->feed;
+    s[1].exit = 0;
+    queuePushBlock(s, 2);
+    plannerQueued(s, 2);
+    return 1;
+}
+
+/**
+ * Queues the moves of the last line of 'gc'. Returns GCODE_BUSY until they
+ * are queued, then GCODE_DONE; 'gc->result' tells whether the line was
+ * valid.
+ */
+int gcodeRun(struct gcode* gc)
+{
+    struct setpoint s;
+
+    switch (gc->work)
+    {
+        case WORK_LINE:
+            if (!queueLine(gc, gc->target))
+                return GCODE_BUSY;
+            break;
+
+        case WORK_ARC:
+            if (!queueArc(gc))
+                return GCODE_BUSY;
+            break;
+
+        case WORK_DWELL:
+            if (queueFree() == 0)
+                return GCODE_BUSY;
+            s.type = SETPOINT_POSITION; /* Stay put for the dwell. */
+            s.values[0] = toValue(gc->position[0]);
+            s.values[1] = toValue(gc->position[1]);
+            s.values[2] = toValue(gc->position[2]);
+            s.param = gc->dwellMs;
+            s.exit = 0;
+            queuePush(&s);
+            plannerQueued(&s, 1);
+            break;
+    }
+    gc->work = WORK_NONE;
+    return GCODE_DONE;
+}
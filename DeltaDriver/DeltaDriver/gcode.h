@@ -0,0 +1,96 @@
+/**
+ * Implements the streaming G-code interpreter for pen plotter jobs.
+ */
+
+#ifndef __GCODE_H
+#define __GCODE_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** SUPPORTED SUBSET. */
+/* G0 (rapid line), G1 (line at the feed rate), G2/G3 (clockwise/counter-
+   clockwise arc in the XY-plane, centre given by I, J or radius by R), G4
+   (dwell for P seconds), G20/G21 (inches/millimetres), G90/G91 (absolute/
+   relative) and F (feed rate per minute). N, M, S and T words are ignored,
+   and so are comments in '()' or after ';'. A line ends with '\n'; '\r' is
+   ignored.
+   Numbers have at most GCODE_MAX_DIGITS digits before the point; digits past
+   the fourth after it are dropped. */
+#define GCODE_MAX_DIGITS    5
+#define GCODE_SCALE         10000L  /* Numbers are kept in 1/10000ths. */
+
+/** COORDINATES. */
+/* X0 Y0 is the centre of the paper and Z0 its surface, so positive Z lifts
+   the pen. The interpreter assumes the robot starts at home. */
+#define GCODE_ORIGIN_Z      Z_PEN_PAPER
+#define GCODE_ARC_TOLERANCE 0.010   /* Inches the end of an arc may be off
+                                       its circle. */
+
+/** RESULTS. */
+#define GCODE_NONE          0     /* Byte consumed, line not complete. */
+#define GCODE_READY         1     /* Line complete: call gcodeRun. */
+#define GCODE_BUSY          0     /* gcodeRun is waiting for queue room. */
+#define GCODE_DONE          1     /* gcodeRun has queued the whole line. */
+
+/** ERRORS. */
+#define GCODE_OK            0
+#define GCODE_ERR_SYNTAX    1     /* Letter without a number, or bad number. */
+#define GCODE_ERR_WORD      2     /* Unsupported letter or G code. */
+#define GCODE_ERR_ARC       3     /* Arc without a valid centre. */
+
+/** WORDS. */
+#define GW_X                0
+#define GW_Y                1
+#define GW_Z                2
+#define GW_I                3
+#define GW_J                4
+#define GW_R                5
+#define GW_F                6
+#define GW_P                7
+#define GCODE_WORDS         8
+
+/**
+ * Represents the state of the interpreter.
+ */
+struct gcode
+{
+    /* The line being read. */
+    uint8_t state;
+    uint8_t letter;         /* Letter of the word being read. */
+    uint8_t digits;         /* Digits before the point. */
+    uint8_t decimals;       /* Digits after the point, or 0xFF before it. */
+    uint8_t negative;
+    int32_t number;         /* Magnitude in 1/GCODE_SCALE. */
+    uint8_t seen;           /* Bit per word in 'words'. */
+    uint8_t dwell;          /* 1 if the line has G4. */
+    uint8_t error;          /* GCODE_OK or GCODE_ERR_*, of this line. */
+    uint8_t result;         /* Likewise, of the last complete line. */
+    int32_t words[GCODE_WORDS];
+
+    /* Modal state. */
+    uint8_t motion;         /* 0 to 3, the last of G0 - G3. */
+    uint8_t inches;         /* 1 after G20. */
+    uint8_t relative;       /* 1 after G91. */
+    uint16_t feed;          /* Thousandths of an inch per second. */
+    int32_t position[3];    /* Last queued point, thousandths of an inch. */
+
+    /* Work of the complete line, queued by gcodeRun. */
+    uint8_t work;
+    int32_t target[3];
+    uint16_t dwellMs;
+    int32_t arcCentre[2];   /* Thousandths of an inch. */
+};
+
+/**
+ * Functions.
+ */
+void gcodeReset(struct gcode* gc);
+void gcodeDiscardLine(struct gcode* gc);
+int gcodeFeed(struct gcode* gc, char dataIn);
+int gcodeRun(struct gcode* gc);
+
+#endif /* GCODE_H */
@@ -0,0 +1,26 @@
+/**
+ * Lists the messages of the tokenized log. Each entry is
+ * LOG_MESSAGE(id, signature, format): the ID is its place in this list, the
+ * signature gives the arguments as Python struct codes (b/B int8, h/H int16,
+ * l/L int32, f float) and the format is only read by Python/logdecode.py.
+ * Add new messages at the end, so logs of older builds still decode.
+ *
+ * No include guard: it is included once per definition of LOG_MESSAGE.
+ */
+
+LOG_MESSAGE(LOG_INPUT_ERROR,      "",    "Error!")
+LOG_MESSAGE(LOG_NEW_INPUT,        "fff", "New input: X: %f Y: %f Z: %f")
+LOG_MESSAGE(LOG_POINT_VALID,      "",    "Point is valid.")
+LOG_MESSAGE(LOG_NO_SOLUTION,      "",    "No kinematic solution.")
+LOG_MESSAGE(LOG_PROPOSED_POINT,   "fff", "Proposed: X: %f Y: %f Z: %f")
+LOG_MESSAGE(LOG_PROPOSED_ANGLES,  "fff", "Angle 1: %f Angle 2: %f Angle 3: %f")
+LOG_MESSAGE(LOG_PROPOSED_TICKS,   "hhh", "Motor 1: %d Motor 2: %d Motor 3: %d")
+LOG_MESSAGE(LOG_CONFIRM,          "",    "Confirm?? (y/n)")
+LOG_MESSAGE(LOG_POINT_INVALID,    "",    "Point is not valid. Abort.")
+LOG_MESSAGE(LOG_COMMAND_SENT,     "",    "Command sent!")
+LOG_MESSAGE(LOG_ABORT_SEND,       "",    "Abort send!!")
+LOG_MESSAGE(LOG_BAD_DATA,         "",    "Bad data!")
+LOG_MESSAGE(LOG_COMM_STATUS,      "B",   "Dynamixel COMM_ status %d")
+LOG_MESSAGE(LOG_SERVO_ERROR,      "B",   "Dynamixel ERRBIT_ bits 0x%02x")
+LOG_MESSAGE(LOG_SERVO_MISSING,    "B",   "Servo %d does not answer.")
+LOG_MESSAGE(LOG_SERVO_CONFIG,     "BB",  "Servo register %d set to %d")
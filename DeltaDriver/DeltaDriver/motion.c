@@ -0,0 +1,519 @@
+#include <stdint.h>
+#include <math.h>
+#include "functions.h"
+#include "queue.h"
+#include "motion.h"
+
+/**
+ * Implements the on-board interpolation of motion segments. A segment starts
+ * at the last commanded point and is cut into one sub-step per servo tick;
+ * every sub-step goes through the inverse kinematics, so a line stays
+ * straight in Cartesian space instead of becoming an arc in joint space.
+ *
+ * Lines and arcs follow a velocity profile: a ramp up from the velocity the
+ * previous segment ended at, a cruise at the feed rate (capped by the velocity
+ * limit), and a ramp down to the exit velocity set by the planner (rest by
+ * default), planned once when the segment starts. A trapezoidal ramp has
+ * constant acceleration; an S-curve ramp follows a smoothstep in velocity, so
+ * the acceleration itself ramps up and down and the jerk is bounded. Both
+ * keep the peak acceleration at the limit.
+ *
+ * Arcs turn a unit vector about the centre by the angle of each sub-step with
+ * a rotation recurrence. The sine and cosine of the small step angle come
+ * from their Taylor series, so a sub-step needs no trigonometric call. The
+ * velocity on an arc is also capped so that each sub-step's chord stays
+ * within MOTION_ARC_TOLERANCE of the arc, and so that the centripetal
+ * acceleration stays within the limit.
+ *
+ * Bezier curves are timed by the host, and evaluated by forward
+ * differencing: each sub-step is three additions per axis.
+ */
+
+#define SEGMENT_NONE        0
+#define SEGMENT_PROFILED    1   /* Line, stepped along its velocity profile. */
+#define SEGMENT_DIFFERENCED 2   /* Bezier, stepped by forward differences. */
+#define SEGMENT_ARC         3   /* Arc, stepped along its velocity profile. */
+
+static const struct point HOME = {0, 0, MOTION_HOME_Z};
+
+static struct point position;       /* Last commanded point. */
+static uint8_t positionKnown = 0;   /* 0 after a move given in servo ticks. */
+
+static uint8_t segment = SEGMENT_NONE;
+static struct point target;         /* End of the current segment. */
+
+/* Profiled segments: start + direction * distance(elapsed). */
+static struct point start;
+static struct point direction;      /* Unit vector. */
+static double elapsed;              /* Seconds since the segment started. */
+static double period;               /* Seconds per sub-step. */
+static double vStart, vPeak, vEnd;  /* Inches per second. */
+static double tAccel, tCruise, tDecel; /* Seconds. */
+static double dAccel, dCruise;      /* Inches. */
+static double vCarried = 0;         /* Velocity the last line ended at. */
+static double tCarried;             /* Seconds between its end and the tick. */
+
+/* Arcs: centre + unit * radius(distance), turned by each sub-step. */
+static struct arc arc;
+static double unitX, unitY;         /* From the centre, turned so far. */
+static double travelled;            /* Inches along the arc so far. */
+
+/* Differenced segments. */
+static struct point d1, d2, d3;     /* Forward differences per sub-step. */
+static uint16_t stepsLeft = 0;      /* Sub-steps left in the segment. */
+
+static struct point control[2];     /* Inner Bezier control points, or the
+                                       centre of an arc. */
+static uint8_t controlCount = 0;
+
+/* Limits. */
+static double maxVelocity = MOTION_MAX_VELOCITY;
+static double maxAcceleration = MOTION_MAX_ACCELERATION;
+static uint8_t profileType = MOTION_PROFILE;
+
+/**
+ * Forgets any segment in progress, and assumes the robot is at HOME.
+ */
+void motionReset(void)
+{
+    segment = SEGMENT_NONE;
+    motionSetPosition(HOME);
+}
+
+/**
+ * Records that the robot was sent directly to 'p'.
+ */
+void motionSetPosition(struct point p)
+{
+    position = p;
+    positionKnown = 1;
+    vCarried = 0;
+}
+
+/**
+ * Records that the robot was moved in joint space, so the next segment has
+ * no known starting point and jumps straight to its end.
+ */
+void motionForgetPosition(void)
+{
+    segment = SEGMENT_NONE;
+    positionKnown = 0;
+    vCarried = 0;
+}
+
+/**
+ * Sets the Cartesian velocity (in/s) and acceleration (in/s^2) limits of
+ * lines, and their profile (PROFILE_TRAPEZOID or PROFILE_SCURVE). Takes
+ * effect from the next line.
+ */
+void motionSetLimits(double velocity, double acceleration, uint8_t profile)
+{
+    if (velocity > 0)
+        maxVelocity = velocity;
+    if (acceleration > 0)
+        maxAcceleration = acceleration;
+    profileType = profile;
+}
+
+/**
+ * Returns the point, in inches, of the setpoint 's'.
+ */
+static struct point setpointPoint(const struct setpoint* s)
+{
+    struct point p;
+
+    p.x = s->values[0] / 1000.;
+    p.y = s->values[1] / 1000.;
+    p.z = s->values[2] / 1000.;
+    return p;
+}
+
+/**
+ * Stores the inner control point of a Bezier segment carried by 's'
+ * (SETPOINT_CONTROL). The segment itself follows in the queue.
+ */
+void motionControl(const struct setpoint* s)
+{
+    if (controlCount < 2)
+        control[controlCount++] = setpointPoint(s);
+}
+
+/**
+ * Returns the number of sub-steps of 'periodUs' microseconds in 'ms'
+ * milliseconds, at least 1.
+ */
+static uint16_t stepsIn(uint16_t ms, uint16_t periodUs)
+{
+    uint32_t steps = ((uint32_t) ms * 1000 + periodUs / 2) / periodUs;
+
+    if (steps < 1)
+        return 1;
+    if (steps > UINT16_MAX)
+        return UINT16_MAX;
+    return (uint16_t) steps;
+}
+
+/**
+ * Sets up the forward differences of the cubic Bezier from 'p0' through
+ * control points 'p1' and 'p2' to 'p3' on one axis, for 'stepsLeft' steps.
+ * With B(t) = a t^3 + b t^2 + c t + p0 and h = 1 / stepsLeft, the first,
+ * second and third differences at t = 0 are a h^3 + b h^2 + c h,
+ * 6 a h^3 + 2 b h^2 and 6 a h^3.
+ */
+static void bezierAxis(double p0, double p1, double p2, double p3,
+                       double* first, double* second, double* third)
+{
+    double h = 1.0 / stepsLeft;
+    double a = -p0 + 3 * p1 - 3 * p2 + p3;
+    double b = 3 * p0 - 6 * p1 + 3 * p2;
+    double c = -3 * p0 + 3 * p1;
+
+    *third = 6 * a * h * h * h;
+    *second = *third + 2 * b * h * h;
+    *first = a * h * h * h + b * h * h + c * h;
+}
+
+/**
+ * Returns the cruise velocity, in/s, of a line with feed rate 'feed' in
+ * thousandths of an inch per second: the feed rate, capped by the limit.
+ */
+double motionSpeedLimit(uint16_t feed)
+{
+    double v = feed / 1000.;
+
+    if (v <= 0 || v > maxVelocity)
+        return maxVelocity;
+    return v;
+}
+
+/**
+ * Describes in 'a' the arc from 'from' about 'centre' (z unused) to 'to',
+ * clockwise if 'clockwise' is 1, seen from above. An arc that ends where it
+ * starts is a full circle. The radius may change from start to end, as the
+ * end of an arc given by its centre is rarely exactly on the circle. Returns
+ * 0 if the start or the end is on the centre.
+ */
+int motionArc(struct arc* a, struct point from, struct point centre,
+              struct point to, uint8_t clockwise)
+{
+    double endAngle;
+
+    a->centre = centre;
+    a->radius = hypot(from.x - centre.x, from.y - centre.y);
+    a->endRadius = hypot(to.x - centre.x, to.y - centre.y);
+    if (a->radius < 1e-4 || a->endRadius < 1e-4)
+        return 0;
+    a->startAngle = atan2(from.y - centre.y, from.x - centre.x);
+    endAngle = atan2(to.y - centre.y, to.x - centre.x);
+    a->sweep = endAngle - a->startAngle;
+    if (clockwise && a->sweep >= -1e-6)
+        a->sweep -= 2 * M_PI;
+    else if (!clockwise && a->sweep <= 1e-6)
+        a->sweep += 2 * M_PI;
+    a->rise = to.z - from.z;
+    a->length = hypot(fabs(a->sweep) * (a->radius + a->endRadius) / 2,
+                      a->rise);
+    return 1;
+}
+
+/**
+ * Stores in 'entry' and 'exit' the unit directions of travel at the start
+ * and at the end of the arc 'a'.
+ */
+void motionArcTangents(const struct arc* a, struct point* entry,
+                       struct point* exit)
+{
+    double turn = (a->sweep < 0) ? -1 : 1;
+    double flat = fabs(a->sweep) * (a->radius + a->endRadius) / 2 /
+                  a->length;
+    double angle = a->startAngle + a->sweep;
+
+    entry->x = -turn * sin(a->startAngle) * flat;
+    entry->y = turn * cos(a->startAngle) * flat;
+    entry->z = a->rise / a->length;
+    exit->x = -turn * sin(angle) * flat;
+    exit->y = turn * cos(angle) * flat;
+    exit->z = entry->z;
+}
+
+/**
+ * Returns the cruise velocity, in/s, of the arc 'a' with feed rate 'feed'
+ * in thousandths of an inch per second, cut into sub-steps of 'periodUs'
+ * microseconds. Besides the line limit, the centripetal acceleration v^2 / r
+ * stays within the ramp acceleration, and a sub-step turns at most by the
+ * angle 2 acos(1 - tol / r) whose chord is within the tolerance.
+ */
+double motionArcSpeedLimit(uint16_t feed, const struct arc* a,
+                           uint16_t periodUs)
+{
+    double v = motionSpeedLimit(feed);
+    double r = (a->radius < a->endRadius) ? a->radius : a->endRadius;
+    double limit = sqrt(motionRampAcceleration() * r);
+
+    if (limit < v)
+        v = limit;
+    if (r > MOTION_ARC_TOLERANCE)
+    {
+        limit = 2 * acos(1 - MOTION_ARC_TOLERANCE / r) * r / (periodUs / 1e6);
+        if (limit < v)
+            v = limit;
+    }
+    return v;
+}
+
+/**
+ * Returns the acceleration used to size ramps. A smoothstep ramp peaks at
+ * 1.5 times its mean acceleration, so an S-curve ramp is sized at 2/3 of the
+ * limit.
+ */
+double motionRampAcceleration(void)
+{
+    if (profileType == PROFILE_SCURVE)
+        return maxAcceleration * 2 / 3;
+    return maxAcceleration;
+}
+
+/**
+ * Returns the distance covered 't' seconds into a ramp from 'v0' to 'v1'
+ * lasting 'duration' seconds. With r = t / duration, the velocity is
+ * v0 + (v1 - v0) S(r), where S(r) = r for a trapezoid and 3 r^2 - 2 r^3 for
+ * an S-curve; the distance integrates it.
+ */
+static double rampDistance(double v0, double v1, double duration, double t)
+{
+    double r;
+    double shape;
+
+    if (duration <= 0)
+        return 0;
+    r = t / duration;
+    if (profileType == PROFILE_SCURVE)
+        shape = r * r * r - r * r * r * r / 2;
+    else
+        shape = r * r / 2;
+    return v0 * t + (v1 - v0) * duration * shape;
+}
+
+/**
+ * Plans the velocity profile of a line of 'length' inches, starting at
+ * 'vStart' and ending at 'vEnd', cruising at no more than 'vMax'. Returns
+ * the duration of the line in seconds.
+ */
+static double planProfile(double length, double vMax)
+{
+    double accel = motionRampAcceleration();
+    double vReach;
+
+    /* The end velocity must be reachable from the start within 'length'. */
+    vReach = sqrt(vStart * vStart + 2 * accel * length);
+    if (vEnd > vReach)
+        vEnd = vReach;
+    vReach = vStart * vStart - 2 * accel * length;
+    if (vEnd * vEnd < vReach)
+        vStart = sqrt(vEnd * vEnd + 2 * accel * length); /* Too fast. */
+
+    /* Peak where the ramp up meets the ramp down, unless capped. */
+    vPeak = sqrt(accel * length + (vStart * vStart + vEnd * vEnd) / 2);
+    if (vPeak > vMax)
+        vPeak = vMax;
+    if (vPeak < vStart)
+        vPeak = vStart;
+    if (vPeak < vEnd)
+        vPeak = vEnd;
+
+    tAccel = (vPeak - vStart) / accel;
+    tDecel = (vPeak - vEnd) / accel;
+    dAccel = (vStart + vPeak) / 2 * tAccel;
+    dCruise = length - dAccel - (vPeak + vEnd) / 2 * tDecel;
+    if (dCruise < 0)
+        dCruise = 0;
+    tCruise = (vPeak > 0) ? dCruise / vPeak : 0;
+    return tAccel + tCruise + tDecel;
+}
+
+/**
+ * Returns the distance along the current line 't' seconds after it started.
+ */
+static double profileDistance(double t)
+{
+    if (t < tAccel)
+        return rampDistance(vStart, vPeak, tAccel, t);
+    t -= tAccel;
+    if (t < tCruise)
+        return dAccel + vPeak * t;
+    t -= tCruise;
+    return dAccel + dCruise + rampDistance(vPeak, vEnd, tDecel, t);
+}
+
+/**
+ * Starts the segment 's' (SETPOINT_LINE, SETPOINT_ARC_CW, SETPOINT_ARC_CCW or
+ * SETPOINT_BEZIER) from the last commanded point, cut into sub-steps of
+ * 'periodUs' microseconds each.
+ */
+void motionBegin(const struct setpoint* s, uint16_t periodUs)
+{
+    double length;
+    double vMax;
+
+    target = setpointPoint(s);
+    if (s->type == SETPOINT_BEZIER)
+    {
+        if (controlCount < 2 || !positionKnown)
+            stepsLeft = 1; /* Incomplete, or no start: jump to the end. */
+        else
+            stepsLeft = stepsIn(s->param, periodUs);
+        controlCount = 0;
+        vCarried = 0;
+        bezierAxis(position.x, control[0].x, control[1].x, target.x,
+                   &d1.x, &d2.x, &d3.x);
+        bezierAxis(position.y, control[0].y, control[1].y, target.y,
+                   &d1.y, &d2.y, &d3.y);
+        bezierAxis(position.z, control[0].z, control[1].z, target.z,
+                   &d1.z, &d2.z, &d3.z);
+        segment = SEGMENT_DIFFERENCED;
+        return;
+    }
+
+    start = position;
+    if (s->type == SETPOINT_ARC_CW || s->type == SETPOINT_ARC_CCW)
+    {
+        segment = SEGMENT_ARC;
+        if (controlCount < 1 || !positionKnown ||
+            !motionArc(&arc, start, control[0], target,
+                       s->type == SETPOINT_ARC_CW))
+        {
+            segment = SEGMENT_PROFILED; /* No arc: a line to the end. */
+        }
+        controlCount = 0;
+    }
+    else
+    {
+        segment = SEGMENT_PROFILED;
+    }
+
+    if (segment == SEGMENT_ARC)
+    {
+        length = arc.length;
+        vMax = motionArcSpeedLimit(s->param, &arc, periodUs);
+        unitX = cos(arc.startAngle);
+        unitY = sin(arc.startAngle);
+        travelled = 0;
+    }
+    else
+    {
+        direction.x = target.x - start.x;
+        direction.y = target.y - start.y;
+        direction.z = target.z - start.z;
+        length = sqrt(direction.x * direction.x + direction.y * direction.y +
+                      direction.z * direction.z);
+        vMax = motionSpeedLimit(s->param);
+    }
+
+    period = periodUs / 1e6;
+    elapsed = 0;
+    if (vCarried > 0)
+        elapsed = tCarried - period; /* The first sub-step is this tick's. */
+    vStart = vCarried;
+    vEnd = s->exit / 1000.;
+    if (!positionKnown || length < 1e-6)
+    {
+        tAccel = tCruise = tDecel = 0; /* Jump to the end. */
+        if (!positionKnown)
+            vCarried = 0;
+        vEnd = vCarried; /* A line of no length keeps the pace. */
+        segment = SEGMENT_PROFILED;
+    }
+    else
+    {
+        direction.x /= length;
+        direction.y /= length;
+        direction.z /= length;
+        planProfile(length, vMax);
+    }
+}
+
+/**
+ * Moves 'position' to 'distance' inches along the current arc, turning the
+ * unit vector from the centre by the angle since the last sub-step.
+ */
+static void arcStep(double distance)
+{
+    double step = (distance - travelled) / arc.length * arc.sweep;
+    double step2 = step * step;
+    double c = 1 - step2 / 2 + step2 * step2 / 24; /* cos(step) */
+    double s = step * (1 - step2 / 6);              /* sin(step) */
+    double x = unitX;
+    double fraction = distance / arc.length;
+    double radius = arc.radius + (arc.endRadius - arc.radius) * fraction;
+
+    unitX = c * x - s * unitY;
+    unitY = s * x + c * unitY;
+    travelled = distance;
+    position.x = arc.centre.x + unitX * radius;
+    position.y = arc.centre.y + unitY * radius;
+    position.z = start.z + arc.rise * fraction;
+}
+
+/**
+ * Advances the current segment by one sub-step and stores the new point in
+ * 'p'. Returns 0, and leaves 'p' alone, if no segment is in progress, or if a
+ * line or arc ended while still moving: then the sub-step belongs to the next
+ * segment, which the planner guarantees is queued.
+ */
+int motionNext(struct point* p)
+{
+    double distance;
+
+    switch (segment)
+    {
+        case SEGMENT_PROFILED:
+        case SEGMENT_ARC:
+            elapsed += period;
+            if (elapsed >= tAccel + tCruise + tDecel)
+            {
+                position = target;
+                segment = SEGMENT_NONE;
+                vCarried = vEnd;
+                if (vCarried > 0)
+                {
+                    tCarried = elapsed - (tAccel + tCruise + tDecel);
+                    return 0;
+                }
+                break;
+            }
+            distance = profileDistance(elapsed);
+            if (segment == SEGMENT_ARC)
+            {
+                arcStep(distance);
+                break;
+            }
+            position.x = start.x + direction.x * distance;
+            position.y = start.y + direction.y * distance;
+            position.z = start.z + direction.z * distance;
+            break;
+
+        case SEGMENT_DIFFERENCED:
+            if (--stepsLeft == 0)
+            {
+                position = target; /* No accumulated rounding at the end. */
+                segment = SEGMENT_NONE;
+                break;
+            }
+            position.x += d1.x;
+            d1.x += d2.x;
+            d2.x += d3.x;
+            position.y += d1.y;
+            d1.y += d2.y;
+            d2.y += d3.y;
+            position.z += d1.z;
+            d1.z += d2.z;
+            d2.z += d3.z;
+            break;
+
+        default:
+            return 0;
+    }
+    positionKnown = 1;
+    *p = position;
+    return 1;
+}
@@ -0,0 +1,66 @@
+/**
+ * Implements the on-board interpolation of motion segments.
+ */
+
+#ifndef __MOTION_H
+#define __MOTION_H
+
+#include <stdint.h>
+#include "functions.h"
+#include "queue.h"
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** VELOCITY PROFILES. */
+#define PROFILE_TRAPEZOID   0     /* Constant acceleration ramps. */
+#define PROFILE_SCURVE      1     /* Smoothstep ramps, bounded jerk. */
+
+/** HOME. */
+#define MOTION_HOME_Z      -8.5064  /* Inches, at x = y = 0. */
+
+/** ARCS. */
+#define MOTION_ARC_TOLERANCE  0.002   /* Inches between an arc and the chord
+                                         of a sub-step. */
+
+/** DEFAULT LIMITS. */
+/* Cartesian limits of lines, changed at run time with CMD_LIMITS. */
+#define MOTION_MAX_VELOCITY       5.0   /* Inches per second. */
+#define MOTION_MAX_ACCELERATION  20.0   /* Inches per second squared. */
+#define MOTION_PROFILE            PROFILE_SCURVE
+
+/**
+ * Describes an arc in the XY-plane, rising linearly in z.
+ */
+struct arc
+{
+    struct point centre;    /* z unused. */
+    double radius;          /* At the start, in inches. */
+    double endRadius;       /* At the end. */
+    double startAngle;      /* Radians. */
+    double sweep;           /* Radians, negative clockwise. */
+    double rise;            /* Inches in z from start to end. */
+    double length;          /* Inches along the arc. */
+};
+
+/**
+ * Functions.
+ */
+void motionReset(void);
+void motionSetPosition(struct point p);
+void motionForgetPosition(void);
+void motionSetLimits(double velocity, double acceleration, uint8_t profile);
+double motionSpeedLimit(uint16_t feed);
+double motionRampAcceleration(void);
+int motionArc(struct arc* a, struct point from, struct point centre,
+              struct point to, uint8_t clockwise);
+void motionArcTangents(const struct arc* a, struct point* entry,
+                       struct point* exit);
+double motionArcSpeedLimit(uint16_t feed, const struct arc* a,
+                           uint16_t periodUs);
+void motionControl(const struct setpoint* s);
+void motionBegin(const struct setpoint* s, uint16_t periodUs);
+int motionNext(struct point* p);
+
+#endif /* MOTION_H */
@@ -0,0 +1,172 @@
+#include <stdint.h>
+#include "parser.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#define PARSER_TABLE        PROGMEM
+#define PARSER_READ(x)      pgm_read_byte(&(x))
+#else
+#define PARSER_TABLE
+#define PARSER_READ(x)      (x)
+#endif
+
+/**
+ * Implements the table-driven parser of the ASCII command protocol. Each byte
+ * is mapped to a character class, and TRANSITIONS gives the action and next
+ * state for the current state and that class. Both tables are in flash on the
+ * AVR. Fields are accumulated in int32_t, so no floating point is needed per
+ * digit. A digit inside a command always accumulates, so digits, which are
+ * most of the stream, skip both tables.
+ */
+
+/* States. */
+#define S_IDLE      0   /* Waiting for '$' or '%'. */
+#define S_FIELD     1   /* Start of a field: '-' or a digit. */
+#define S_SIGN      2   /* After '-': a digit. */
+#define S_DIGITS    3   /* In a number: digit, ',' or '*'. */
+
+/* Character classes. */
+#define C_DIGIT     0
+#define C_MINUS     1
+#define C_COMMA     2
+#define C_STAR      3
+#define C_DOLLAR    4
+#define C_PERCENT   5
+#define C_OTHER     6
+#define NUM_CLASSES 7
+
+/* Actions, stored in the high nibble of a transition. */
+#define A_OTHER     0x00  /* Byte outside of a command. */
+#define A_BEGIN_POS 0x10  /* Start a position command. */
+#define A_BEGIN_ANG 0x20  /* Start an angle command. */
+#define A_NEG       0x30  /* Field is negative. */
+#define A_DIGIT     0x40  /* Accumulate a digit. */
+#define A_NEXT      0x50  /* Field complete, read the next. */
+#define A_DONE      0x60  /* Last field complete. */
+#define A_ERROR     0x70  /* Malformed command. */
+
+#define BEGIN_POS   (A_BEGIN_POS | S_FIELD)
+#define BEGIN_ANG   (A_BEGIN_ANG | S_FIELD)
+#define ERROR       (A_ERROR | S_IDLE)
+
+static const uint8_t TRANSITIONS[4][NUM_CLASSES] PARSER_TABLE =
+{
+    /*           DIGIT               MINUS              COMMA
+                 STAR                DOLLAR             PERCENT
+                 OTHER */
+    /* IDLE */ {A_OTHER | S_IDLE,    A_OTHER | S_IDLE,  A_OTHER | S_IDLE,
+                A_OTHER | S_IDLE,    BEGIN_POS,         BEGIN_ANG,
+                A_OTHER | S_IDLE},
+    /* FIELD */{A_DIGIT | S_DIGITS,  A_NEG | S_SIGN,    ERROR,
+                ERROR,               BEGIN_POS,         BEGIN_ANG,
+                ERROR},
+    /* SIGN */ {A_DIGIT | S_DIGITS,  ERROR,             ERROR,
+                ERROR,               BEGIN_POS,         BEGIN_ANG,
+                ERROR},
+    /* DIGITS */{A_DIGIT | S_DIGITS, ERROR,             A_NEXT | S_FIELD,
+                A_DONE | S_IDLE,     BEGIN_POS,         BEGIN_ANG,
+                ERROR}
+};
+
+/* Character class of each 7-bit byte; bytes above 0x7F are C_OTHER. */
+#define O C_OTHER
+static const uint8_t CLASSES[128] PARSER_TABLE =
+{
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,
+    /*    !  "  #  $         %          &  '  (  )  *        +  ,        -        .  / */
+    O, O, O, O, C_DOLLAR, C_PERCENT, O, O, O, O, C_STAR, O, C_COMMA, C_MINUS, O, O,
+    /* 0 - 9 */
+    C_DIGIT, C_DIGIT, C_DIGIT, C_DIGIT, C_DIGIT, C_DIGIT, C_DIGIT, C_DIGIT,
+    C_DIGIT, C_DIGIT, O, O, O, O, O, O,
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O
+};
+#undef O
+
+/**
+ * Starts a new field in 'ps'.
+ */
+static void beginField(struct parser* ps)
+{
+    ps->digits = 0;
+    ps->negative = 0;
+    ps->value = 0;
+}
+
+/**
+ * Resets 'ps' to wait for a new command.
+ */
+void parserReset(struct parser* ps)
+{
+    ps->state = S_IDLE;
+    ps->field = 0;
+    ps->type = PARSE_POSITION;
+    beginField(ps);
+}
+
+/**
+ * Feeds the byte 'dataIn' to the parser 'ps'. Returns PARSE_POSITION or
+ * PARSE_ANGLE when a command is complete (the fields are in 'ps->values'),
+ * PARSE_OTHER for a byte outside of a command, PARSE_ERROR when a malformed
+ * command is dropped, and PARSE_NONE otherwise.
+ */
+int parserFeed(struct parser* ps, char dataIn)
+{
+    uint8_t byte = (uint8_t) dataIn;
+    uint8_t digit = byte - '0';
+    uint8_t transition;
+
+    if (digit <= 9 && ps->state != S_IDLE)
+    {
+        if (ps->digits == PARSE_MAX_DIGITS)
+        {
+            ps->state = S_IDLE;
+            return PARSE_ERROR; /* The field would overflow. */
+        }
+        ps->state = S_DIGITS;
+        ps->digits++;
+        ps->value = ps->value * 10 + digit;
+        return PARSE_NONE;
+    }
+
+    transition = PARSER_READ(TRANSITIONS[ps->state][(byte & 0x80) ?
+                             C_OTHER : PARSER_READ(CLASSES[byte])]);
+    ps->state = transition & 0x0F;
+
+    switch (transition & 0xF0)
+    {
+        case A_OTHER:
+            return PARSE_OTHER;
+
+        case A_BEGIN_POS:
+        case A_BEGIN_ANG:
+            ps->type = ((transition & 0xF0) == A_BEGIN_POS) ? PARSE_POSITION
+                                                             : PARSE_ANGLE;
+            ps->field = 0;
+            beginField(ps);
+            return PARSE_NONE;
+
+        case A_NEG:
+            ps->negative = 1;
+            return PARSE_NONE;
+
+        case A_NEXT:
+        case A_DONE:
+            if ((ps->field == PARSE_FIELDS - 1) != ((transition & 0xF0) ==
+                                                     A_DONE))
+                break; /* Wrong number of fields. */
+            ps->values[ps->field] = ps->negative ? -ps->value : ps->value;
+            if ((transition & 0xF0) == A_DONE)
+                return ps->type;
+            ps->field++;
+            beginField(ps);
+            return PARSE_NONE;
+    }
+
+    /* A_ERROR, or a wrong number of fields. */
+    ps->state = S_IDLE;
+    return PARSE_ERROR;
+}
@@ -0,0 +1,49 @@
+/**
+ * Implements the table-driven parser of the ASCII command protocol.
+ */
+
+#ifndef __PARSER_H
+#define __PARSER_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** COMMAND FORMAT. */
+/* '$x,y,z*' is a position in thousandths of an inch, '%a,b,c*' are goal
+   positions in servo ticks. Each field is an optional '-' followed by 1 to
+   PARSE_MAX_DIGITS digits, so it always fits in an int32_t. A '$' or '%'
+   anywhere restarts the command. */
+#define PARSE_FIELDS        3
+#define PARSE_MAX_DIGITS    9
+
+/** PARSER RESULTS. */
+#define PARSE_NONE          0     /* Byte consumed, command not complete. */
+#define PARSE_POSITION      1     /* '$x,y,z*' complete. */
+#define PARSE_ANGLE         2     /* '%a,b,c*' complete. */
+#define PARSE_OTHER         3     /* Byte outside of a command (e.g. 'y'). */
+#define PARSE_ERROR         4     /* Malformed command dropped. */
+
+/**
+ * Represents the state of the parser.
+ */
+struct parser
+{
+    uint8_t state;
+    uint8_t field;      /* Index of the field being read. */
+    uint8_t digits;     /* Digits read in this field. */
+    uint8_t negative;   /* 1 if this field has a '-'. */
+    uint8_t type;       /* PARSE_POSITION or PARSE_ANGLE. */
+    int32_t value;      /* Magnitude of this field so far. */
+    int32_t values[PARSE_FIELDS];
+};
+
+/**
+ * Functions.
+ */
+void parserReset(struct parser* ps);
+int parserFeed(struct parser* ps, char dataIn);
+
+#endif /* PARSER_H */
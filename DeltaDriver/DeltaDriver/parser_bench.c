@@ -0,0 +1,190 @@
+/**
+ * Host microbenchmark of the ASCII command parser. Compares parser.c with the
+ * previous parseAll state machine of DeltaDriver.c (copied below), and checks
+ * that both read the same commands. Not part of the firmware build:
+ *
+ *     gcc -O2 -std=gnu99 -o parser_bench parser_bench.c parser.c
+ *     ./parser_bench
+ *
+ * On the AVR the gap is wider than on a host, since every digit of the old
+ * parser is a soft-float multiply.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "parser.h"
+
+#define COMMANDS    4096
+#define PASSES      200
+
+/**
+ * The previous parser, unchanged apart from the output count.
+ */
+#define WATCH_BEGIN 1
+#define WATCH_X 2
+#define WATCH_Y 3
+#define WATCH_Z 4
+#define OLD_DATA 5
+#define NEW_DATA 6
+#define POSITIVE 7
+#define NEGATIVE 8
+#define CONFIRM_DATA 9
+#define SEND_DATA 10
+#define POSITION 11
+#define ANGLE 12
+
+int parseState = WATCH_BEGIN;
+int dataState = OLD_DATA;
+int positionDataType = POSITION;
+double xBuffer = 0;
+double yBuffer = 0;
+double zBuffer = -8.5;
+int signState = POSITIVE;
+
+int parseAll(char dataIn){
+	switch (parseState){
+		case WATCH_BEGIN:
+			if(dataIn == '$'){
+				parseState = WATCH_X;
+				xBuffer = 0; yBuffer = 0; zBuffer = 0;
+				signState = POSITIVE;
+				positionDataType = POSITION;
+			}
+			else if(dataIn == '%'){
+				parseState = WATCH_X;
+				xBuffer = 0; yBuffer = 0; zBuffer = 0;
+				signState = POSITIVE;
+				positionDataType = ANGLE;
+			}
+			else{
+				dataState = OLD_DATA;
+			}
+			break;
+		case WATCH_X:
+			if((dataIn == '0') | (dataIn == '1') | (dataIn == '2') | (dataIn == '3') | (dataIn == '4') | (dataIn == '5') | (dataIn == '6') | (dataIn == '7') | (dataIn == '8') | (dataIn == '9')){
+				xBuffer = (dataIn - '0') + xBuffer*10;
+			}
+			else if(dataIn == ','){
+				parseState = WATCH_Y;
+				if(signState == NEGATIVE)
+					xBuffer = -(xBuffer);
+				signState = POSITIVE;
+			}
+			else if(dataIn == '-'){
+				signState = NEGATIVE;
+			}
+			else{
+				parseState = WATCH_BEGIN;
+			}
+			break;
+		case WATCH_Y:
+			if((dataIn == '0') | (dataIn == '1') | (dataIn == '2') | (dataIn == '3') | (dataIn == '4') | (dataIn == '5') | (dataIn == '6') | (dataIn == '7') | (dataIn == '8') | (dataIn == '9')){
+				yBuffer = (dataIn - '0') + yBuffer*10;
+			}
+			else if(dataIn == ','){
+				parseState = WATCH_Z;
+				if(signState == NEGATIVE)
+				yBuffer = -(yBuffer);
+				signState = POSITIVE;
+			}
+			else if(dataIn == '-'){
+				signState = NEGATIVE;
+			}
+			else{
+				parseState = WATCH_BEGIN;
+			}
+			break;
+		case WATCH_Z:
+			if((dataIn == '0') | (dataIn == '1') | (dataIn == '2') | (dataIn == '3') | (dataIn == '4') | (dataIn == '5') | (dataIn == '6') | (dataIn == '7') | (dataIn == '8') | (dataIn == '9')){
+				zBuffer = (dataIn - '0') + zBuffer*10;
+			}
+			else if(dataIn == '*'){
+				if(signState == NEGATIVE)
+				zBuffer = -(zBuffer);
+				signState = POSITIVE;
+				dataState = NEW_DATA;
+				parseState = WATCH_BEGIN;
+				return 1;
+			}
+			else if(dataIn == '-'){
+				signState = NEGATIVE;
+			}
+			else{
+				parseState = WATCH_BEGIN;
+			}
+			break;
+	}
+	return 0;
+}
+
+/**
+ * Returns seconds of processor time.
+ */
+static double seconds(void)
+{
+    return (double) clock() / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    static char stream[COMMANDS * 24];
+    int length = 0;
+    int pass, i;
+    long oldCount = 0, newCount = 0;
+    double oldSum = 0, newSum = 0;
+    double start, oldTime, newTime;
+    struct parser ps;
+    int result;
+
+    /* Typical commands: positions in thou and angles in ticks. */
+    srand(1);
+    for (i = 0; i < COMMANDS; i++)
+    {
+        if (i % 4 == 3)
+            length += sprintf(stream + length, "%%%d,%d,%d*\n", rand() % 4096,
+                              rand() % 4096, rand() % 4096);
+        else
+            length += sprintf(stream + length, "$%d,%d,%d*\n",
+                              rand() % 9000 - 4500, rand() % 7500 - 3750,
+                              -(rand() % 5000 + 8000));
+    }
+
+    start = seconds();
+    for (pass = 0; pass < PASSES; pass++)
+        for (i = 0; i < length; i++)
+            if (parseAll(stream[i]))
+            {
+                oldCount++;
+                oldSum += xBuffer + yBuffer + zBuffer;
+            }
+    oldTime = seconds() - start;
+
+    parserReset(&ps);
+    start = seconds();
+    for (pass = 0; pass < PASSES; pass++)
+        for (i = 0; i < length; i++)
+        {
+            result = parserFeed(&ps, stream[i]);
+            if (result == PARSE_POSITION || result == PARSE_ANGLE)
+            {
+                newCount++;
+                newSum += ps.values[0] + ps.values[1] + ps.values[2];
+            }
+        }
+    newTime = seconds() - start;
+
+    printf("old parseAll: %10.0f bytes/s (%ld commands)\n",
+           (double) length * PASSES / oldTime, oldCount);
+    printf("parserFeed:   %10.0f bytes/s (%ld commands)\n",
+           (double) length * PASSES / newTime, newCount);
+    printf("speedup:      %10.2fx\n", oldTime / newTime);
+    if (oldCount != newCount || oldSum != newSum)
+    {
+        printf("Mismatch between parsers!\n");
+        return 1;
+    }
+    return 0;
+}
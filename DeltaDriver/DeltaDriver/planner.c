@@ -0,0 +1,228 @@
+#include <stdint.h>
+#include <math.h>
+#include "functions.h"
+#include "queue.h"
+#include "motion.h"
+#include "scheduler.h"
+#include "planner.h"
+
+/**
+ * Implements the look-ahead velocity planner. On its own, every line or arc
+ * starts and ends at rest. The planner remembers the last PLANNER_DEPTH
+ * queued lines and arcs and, whenever one is added, raises the exit
+ * velocities of those before it so the robot only slows down as much as each
+ * corner needs. Arcs take part through their tangents at either end:
+ *
+ * - The junction velocity of a corner follows from its angle. The robot may
+ *   round the corner on an arc that deviates at most JUNCTION_DEVIATION from
+ *   it, with a centripetal acceleration within the limit.
+ * - A backward pass, from the newest line (which must end at rest), lowers
+ *   each entry velocity to what can still be braked down within the line.
+ * - A forward pass, from the oldest line, lowers each exit velocity to what
+ *   can be reached from the entry within the line.
+ *
+ * The new exits go into the queued setpoints, newest first, so the consumer
+ * never takes a line whose successor is planned slower than it expects.
+ * Planned velocities only ever rise as lines are added, so a line already
+ * taken by the consumer keeps a valid, if conservative, plan; motionBegin
+ * clamps every line to its actual entry velocity anyway.
+ */
+
+struct block
+{
+    uint8_t slot;           /* Queue slot of the line or arc. */
+    struct point entryUnit; /* Directions at the start and at the end, */
+    struct point exitUnit;  /* unit vectors; the same for a line. */
+    double length;          /* Inches. */
+    double vMax;            /* Cruise velocity, in/s. */
+    double maxEntry;        /* Junction velocity with the one before. */
+    double entry;           /* Planned entry velocity, in/s. */
+};
+
+static struct block blocks[PLANNER_DEPTH];
+static uint8_t count = 0;               /* Lines remembered, oldest first. */
+static struct point last;               /* End of the last queued setpoint. */
+static uint8_t lastKnown = 0;           /* 0 after a move in servo ticks. */
+
+/**
+ * Forgets all lines, and assumes the robot is at the start of the queue with
+ * an unknown position.
+ */
+void plannerReset(void)
+{
+    count = 0;
+    lastKnown = 0;
+}
+
+/**
+ * Returns the largest velocity at which the robot may go from the line with
+ * unit direction 'u1' into the line with unit direction 'u2', given the
+ * cruise velocity 'vMax' of the slower line and the ramp 'acceleration'.
+ */
+double junctionVelocity(struct point u1, struct point u2, double vMax,
+                        double acceleration)
+{
+    double cosTheta = -(u1.x * u2.x + u1.y * u2.y + u1.z * u2.z);
+    double sinHalf;
+    double v;
+
+    if (cosTheta > 0.999999)
+        return 0;       /* Reversal. */
+    if (cosTheta < -0.999999)
+        return vMax;    /* Straight on. */
+    sinHalf = sqrt((1 - cosTheta) / 2);
+    v = sqrt(acceleration * JUNCTION_DEVIATION * sinHalf / (1 - sinHalf));
+    return (v < vMax) ? v : vMax;
+}
+
+/**
+ * Re-plans the remembered lines and writes the new exit velocities into the
+ * queue, newest first. The newest line ends at rest and the oldest keeps its
+ * entry velocity, which the line before it has already been planned for.
+ */
+static void replan(void)
+{
+    double accel = motionRampAcceleration();
+    double exits[PLANNER_DEPTH];
+    double v;
+    uint8_t i;
+
+    /* Backward pass. */
+    v = 0;
+    for (i = count - 1; i > 0; i--)
+    {
+        v = sqrt(v * v + 2 * accel * blocks[i].length);
+        if (v > blocks[i].maxEntry)
+            v = blocks[i].maxEntry;
+        blocks[i].entry = v;
+    }
+
+    /* Forward pass. */
+    for (i = 0; i < count - 1; i++)
+    {
+        v = sqrt(blocks[i].entry * blocks[i].entry +
+                 2 * accel * blocks[i].length);
+        if (v < blocks[i + 1].entry)
+            blocks[i + 1].entry = v;
+        exits[i] = blocks[i + 1].entry;
+    }
+
+    for (i = count - 1; i > 0; i--)
+        queueSetExit(blocks[i - 1].slot,
+                     (uint16_t) (exits[i - 1] * 1000));
+}
+
+/**
+ * Returns the point, in inches, of the setpoint 's'.
+ */
+static struct point setpointPoint(const struct setpoint* s)
+{
+    struct point p;
+
+    p.x = s->values[0] / 1000.;
+    p.y = s->values[1] / 1000.;
+    p.z = s->values[2] / 1000.;
+    return p;
+}
+
+/**
+ * Adds the line or arc 's', just queued in slot 'slot', and re-plans. An arc
+ * comes after the SETPOINT_CONTROL 'centre'.
+ */
+static void addSegment(const struct setpoint* s,
+                       const struct setpoint* centre, uint8_t slot)
+{
+    struct point end = setpointPoint(s);
+    struct block* b;
+    struct arc a;
+    double length;
+    double vMax;
+    uint8_t i;
+
+    if (!lastKnown)
+    {
+        count = 0; /* The segment jumps to its end. */
+        last = end;
+        lastKnown = 1;
+        return;
+    }
+    if (centre && !motionArc(&a, last, setpointPoint(centre), end,
+                             s->type == SETPOINT_ARC_CW))
+        centre = 0; /* Degenerate: motionBegin draws a line. */
+    length = centre ? a.length :
+             sqrt((end.x - last.x) * (end.x - last.x) +
+                  (end.y - last.y) * (end.y - last.y) +
+                  (end.z - last.z) * (end.z - last.z));
+    if (length < 1e-6)
+        return;     /* Not a move; motionBegin skips it. */
+
+    if (count == PLANNER_DEPTH)
+    {
+        for (i = 1; i < PLANNER_DEPTH; i++)
+            blocks[i - 1] = blocks[i];
+        count--;
+    }
+    b = &blocks[count];
+    b->slot = slot;
+    b->length = length;
+    if (centre)
+    {
+        motionArcTangents(&a, &b->entryUnit, &b->exitUnit);
+        b->vMax = motionArcSpeedLimit(s->param, &a, schedulerPeriod());
+    }
+    else
+    {
+        b->entryUnit.x = (end.x - last.x) / length;
+        b->entryUnit.y = (end.y - last.y) / length;
+        b->entryUnit.z = (end.z - last.z) / length;
+        b->exitUnit = b->entryUnit;
+        b->vMax = motionSpeedLimit(s->param);
+    }
+    b->entry = 0;
+    b->maxEntry = 0;
+    if (count > 0)
+    {
+        vMax = (b->vMax < b[-1].vMax) ? b->vMax : b[-1].vMax;
+        b->maxEntry = junctionVelocity(b[-1].exitUnit, b->entryUnit, vMax,
+                                       motionRampAcceleration());
+    }
+    count++;
+    last = end;
+    if (count > 1)
+        replan();
+}
+
+/**
+ * Tells the planner that the 'n' setpoints of 's' were just queued. A line
+ * or an arc joins the plan; anything else ends it, since the robot comes to
+ * rest.
+ */
+void plannerQueued(const struct setpoint* s, uint8_t n)
+{
+    s += n - 1;
+    switch (s->type)
+    {
+        case SETPOINT_LINE:
+            addSegment(s, 0, queueLastIndex());
+            return;
+
+        case SETPOINT_ARC_CW:
+        case SETPOINT_ARC_CCW:
+            addSegment(s, (n > 1) ? s - 1 : 0, queueLastIndex());
+            return;
+
+        case SETPOINT_POSITION:
+        case SETPOINT_BEZIER:
+            last = setpointPoint(s);
+            lastKnown = 1;
+            break;
+
+        case SETPOINT_TICKS:
+            lastKnown = 0;
+            break;
+
+        default:
+            return; /* Control points wait for their curve. */
+    }
+    count = 0;
+}
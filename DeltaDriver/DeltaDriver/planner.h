@@ -0,0 +1,31 @@
+/**
+ * Implements the look-ahead velocity planner over queued lines and arcs.
+ */
+
+#ifndef __PLANNER_H
+#define __PLANNER_H
+
+#include <stdint.h>
+#include "functions.h"
+#include "queue.h"
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** PLANNER SPECS. */
+/* The planner keeps the last PLANNER_DEPTH lines, so every new line costs
+   at most two passes over PLANNER_DEPTH entries. JUNCTION_DEVIATION sets how
+   fast a corner may be taken: the larger, the faster. */
+#define PLANNER_DEPTH         8
+#define JUNCTION_DEVIATION    0.002   /* Inches. */
+
+/**
+ * Functions.
+ */
+void plannerReset(void);
+void plannerQueued(const struct setpoint* s, uint8_t n);
+double junctionVelocity(struct point u1, struct point u2, double vMax,
+                        double acceleration);
+
+#endif /* PLANNER_H */
@@ -0,0 +1,185 @@
+#include <stdint.h>
+#include "protocol.h"
+
+#ifdef __AVR__
+#include <util/crc16.h>
+#endif
+
+/**
+ * Implements the binary framed command protocol between the host and the
+ * delta robot. Frames are COBS encoded, so FRAME_DELIMITER never appears
+ * inside one, and the receiver can resynchronize on any delimiter.
+ */
+
+static uint8_t rxBuffer[FRAME_MAX_ENCODED]; /* Encoded bytes of this frame. */
+static uint8_t rxLength = 0;                /* Bytes in 'rxBuffer'. */
+static uint8_t rxActive = 0;                /* 1 while inside a frame. */
+
+/**
+ * Returns 'crc' updated with the byte 'data' (CRC-16/CCITT, reflected).
+ */
+uint16_t crc16Update(uint16_t crc, uint8_t data)
+{
+#ifdef __AVR__
+    return _crc_ccitt_update(crc, data);
+#else
+    data ^= (uint8_t) (crc & 0xFF);
+    data ^= data << 4;
+    return ((((uint16_t) data << 8) | (crc >> 8)) ^ (uint8_t) (data >> 4) ^
+            ((uint16_t) data << 3));
+#endif
+}
+
+/**
+ * COBS encodes 'length' bytes of 'in' into 'out', which must have room for
+ * 'length' + 'length' / 254 + 1 bytes. Returns the encoded length.
+ */
+int cobsEncode(const uint8_t* in, int length, uint8_t* out)
+{
+    int codeIndex = 0;
+    int outIndex = 1;
+    uint8_t code = 1;
+    int i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (in[i] == 0)
+        {
+            out[codeIndex] = code;
+            codeIndex = outIndex++;
+            code = 1;
+        }
+        else
+        {
+            out[outIndex++] = in[i];
+            if (++code == 0xFF)
+            {
+                out[codeIndex] = code;
+                codeIndex = outIndex++;
+                code = 1;
+            }
+        }
+    }
+    out[codeIndex] = code;
+    return outIndex;
+}
+
+/**
+ * Decodes 'length' COBS encoded bytes of 'in' into 'out'. Returns the decoded
+ * length, or -1 if 'in' is not valid COBS.
+ */
+int cobsDecode(const uint8_t* in, int length, uint8_t* out)
+{
+    int inIndex = 0;
+    int outIndex = 0;
+    uint8_t code;
+    uint8_t i;
+
+    while (inIndex < length)
+    {
+        code = in[inIndex++];
+        if (code == 0 || inIndex + code - 1 > length)
+            return -1;
+        for (i = 1; i < code; i++)
+            out[outIndex++] = in[inIndex++];
+        if (code != 0xFF && inIndex < length)
+            out[outIndex++] = 0;
+    }
+    return outIndex;
+}
+
+/**
+ * Feeds the received byte 'dataIn' to the frame receiver. Returns FRAME_IDLE
+ * if the byte is not part of a frame (so it belongs to the ASCII protocol),
+ * FRAME_PENDING if it was consumed, FRAME_READY if it completed a valid frame
+ * (stored in 'f'), and FRAME_ERROR if it completed a corrupt one.
+ */
+int frameReceive(uint8_t dataIn, struct frame* f)
+{
+    uint8_t decoded[FRAME_MAX_DECODED];
+    uint16_t crc = 0xFFFF;
+    int length;
+    int i;
+
+    if (dataIn != FRAME_DELIMITER)
+    {
+        if (!rxActive)
+            return FRAME_IDLE;
+        if (rxLength == FRAME_MAX_ENCODED)
+        {
+            rxActive = 0; /* Too long. */
+            return FRAME_ERROR;
+        }
+        rxBuffer[rxLength++] = dataIn;
+        return FRAME_PENDING;
+    }
+
+    /* Opening delimiter, or an empty frame between two delimiters. */
+    if (!rxActive || rxLength == 0)
+    {
+        rxActive = 1;
+        rxLength = 0;
+        return FRAME_PENDING;
+    }
+
+    /* Closing delimiter. */
+    rxActive = 0;
+    length = cobsDecode(rxBuffer, rxLength, decoded);
+    if (length < FRAME_HEADER + FRAME_CRC || length > FRAME_MAX_DECODED)
+        return FRAME_ERROR;
+    for (i = 0; i < length; i++)
+        crc = crc16Update(crc, decoded[i]);
+    if (crc != 0) /* The CRC of data plus its own CRC is zero. */
+        return FRAME_ERROR;
+
+    f->command = decoded[0];
+    f->sequence = decoded[1];
+    f->length = length - FRAME_HEADER - FRAME_CRC;
+    for (i = 0; i < f->length; i++)
+        f->payload[i] = decoded[FRAME_HEADER + i];
+    return FRAME_READY;
+}
+
+/**
+ * Encodes the frame 'f' for the wire, delimiters included, into 'out', which
+ * must have room for FRAME_MAX_ENCODED + 2 bytes. Returns the encoded length.
+ */
+int frameEncode(const struct frame* f, uint8_t* out)
+{
+    uint8_t decoded[FRAME_MAX_DECODED];
+    uint16_t crc = 0xFFFF;
+    int length = 0;
+    int i;
+
+    decoded[length++] = f->command;
+    decoded[length++] = f->sequence;
+    for (i = 0; i < f->length; i++)
+        decoded[length++] = f->payload[i];
+    for (i = 0; i < length; i++)
+        crc = crc16Update(crc, decoded[i]);
+    decoded[length++] = (uint8_t) (crc & 0xFF);
+    decoded[length++] = (uint8_t) (crc >> 8);
+
+    out[0] = FRAME_DELIMITER;
+    length = cobsEncode(decoded, length, out + 1) + 1;
+    out[length++] = FRAME_DELIMITER;
+    return length;
+}
+
+/**
+ * Returns the little-endian int16 at byte 'offset' of the payload of 'f'.
+ */
+int16_t frameGetInt16(const struct frame* f, int offset)
+{
+    return (int16_t) (f->payload[offset] |
+                      ((uint16_t) f->payload[offset + 1] << 8));
+}
+
+/**
+ * Stores 'value' little-endian at byte 'offset' of the payload of 'f'.
+ */
+void framePutInt16(struct frame* f, int offset, int16_t value)
+{
+    f->payload[offset] = (uint8_t) ((uint16_t) value & 0xFF);
+    f->payload[offset + 1] = (uint8_t) ((uint16_t) value >> 8);
+}
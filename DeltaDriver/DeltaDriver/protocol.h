@@ -0,0 +1,143 @@
+/**
+ * Implements the binary framed command protocol between the host and the
+ * delta robot.
+ */
+
+#ifndef __PROTOCOL_H
+#define __PROTOCOL_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** FRAMING. */
+/* A frame on the wire is FRAME_DELIMITER, the COBS encoding of
+   [command, sequence, payload..., crc low, crc high], and FRAME_DELIMITER.
+   The CRC is CRC-16/CCITT (reflected, polynomial 0x8408, initial value
+   0xFFFF) over the command, sequence and payload. Multi-byte fields are
+   little-endian. */
+#define FRAME_DELIMITER     0x00
+#define FRAME_MAX_PAYLOAD   64    /* Longest payload in bytes. */
+#define FRAME_HEADER        2     /* Command and sequence bytes. */
+#define FRAME_CRC           2     /* CRC bytes. */
+#define FRAME_MAX_DECODED   (FRAME_HEADER + FRAME_MAX_PAYLOAD + FRAME_CRC)
+#define FRAME_MAX_ENCODED   (FRAME_MAX_DECODED + FRAME_MAX_DECODED / 254 + 1)
+
+/** COMMANDS. */
+#define CMD_POSITION        0x01  /* int16 x, y, z in thousandths of inch. */
+#define CMD_ANGLE           0x02  /* uint16 goal ticks of servos 1, 2, 3. */
+#define CMD_WAYPOINTS       0x03  /* 1 - WAYPOINTS_MAX of int16 x, y, z in
+                                     thousandths of inch and uint16 time to
+                                     the next waypoint in ms. Queued all or
+                                     none, one slot per waypoint. */
+#define CMD_LINE            0x04  /* int16 x, y, z in thousandths of inch and
+                                     uint16 feed rate in thousandths of an
+                                     inch per second. Queued in one slot. */
+#define CMD_BEZIER          0x05  /* int16 x, y, z of control points 1, 2
+                                     and end point in thousandths of inch,
+                                     and uint16 duration in ms. Starts at
+                                     the current point. Three queue slots. */
+#define CMD_ARC             0x06  /* int16 centre x, y and end point x, y, z
+                                     in thousandths of inch, uint16 feed
+                                     rate in thousandths of an inch per
+                                     second, and uint8 1 if counter-
+                                     clockwise. Starts at the current point;
+                                     ending there is a full circle. Two queue
+                                     slots. */
+#define CMD_CREDIT          0x10  /* Host: empty, asks for a CMD_CREDIT reply.
+                                     Robot: uint8 free queue slots; the
+                                     sequence is the last frame received.
+                                     The host keeps the bytes of frames not
+                                     yet acknowledged within the serial
+                                     receive buffer, whatever the slots. */
+#define CMD_STATS           0x11  /* Host: empty, or uint8 1 to also clear.
+                                     Robot: uint16 tick rate, ticks,
+                                     overruns, max latency us, max duration
+                                     us, last duration us, frame errors,
+                                     queue overflows, log messages
+                                     dropped, goal writes that waited for
+                                     bus queue room. */
+#define CMD_RATE            0x12  /* uint16 servo tick rate in Hz. */
+#define CMD_LIMITS          0x13  /* uint16 max velocity in thousandths of
+                                     inch/s, uint16 max acceleration in
+                                     thousandths of inch/s^2, uint8 profile
+                                     (PROFILE_TRAPEZOID or PROFILE_SCURVE). */
+#define CMD_TELEMETRY       0x14  /* Host: uint16 samples per second, 0 to
+                                     stop. Robot: uint32 time in us, uint16
+                                     present ticks of servos 1, 2, 3, uint16
+                                     loads (bit 10 is the direction), uint8
+                                     temperatures in C, int16 x, y, z in
+                                     thousandths of inch from the present
+                                     ticks (INT16_MIN if unknown), uint8
+                                     queued setpoints and uint8 bit per
+                                     servo that did not answer. The sequence
+                                     counts telemetry frames. */
+#define CMD_LOG             0x15  /* Robot: uint8 message ID (logmessages.h)
+                                     and its arguments. The sequence counts
+                                     log frames. */
+#define CMD_TRACE           0x16  /* Host: empty, or uint8 1 to also clear.
+                                     Robot: uint8 index of the first entry,
+                                     uint8 entries in all, and up to
+                                     TRACE_PER_FRAME of uint8 event, uint8
+                                     arg and uint16 time (trace.h), oldest
+                                     first. The sequence counts trace
+                                     frames. */
+#define CMD_BAUD            0x17  /* Host: uint32 baud rate. Robot, still at
+                                     the old rate: uint32 the rate it
+                                     switches to, or 0 if it cannot. */
+#define CMD_GCODE           0x18  /* uint8 1 to read ASCII bytes outside of
+                                     '$' and '%' commands as G-code, 0 to
+                                     ignore them (the default). */
+
+#define WAYPOINT_SIZE       8     /* Bytes per waypoint. */
+#define WAYPOINTS_MAX       (FRAME_MAX_PAYLOAD / WAYPOINT_SIZE)
+
+/** LINK BAUD RATES. */
+/* USART1 runs at double speed, so at 16 MHz the baud rate is
+   2000000 / (UBRR + 1). Error of the nearest divisor:
+
+        baud  UBRR     actual   error
+       57600    34      57143   -0.8%
+      115200    16     117647   +2.1%
+      250000     7     250000    0.0%
+      500000     3     500000    0.0%
+     1000000     1    1000000    0.0%
+
+   After CMD_BAUD, the robot goes back to the old rate unless a valid frame
+   arrives at the new one within LINK_CONFIRM_MS. */
+#define LINK_DEFAULT_BAUD   57600L
+#define LINK_MAX_BAUD       1000000L
+#define LINK_MAX_ERROR      25    /* Tenths of a percent. */
+#define LINK_CONFIRM_MS     500
+
+/** RECEIVER STATUS. */
+#define FRAME_IDLE          0     /* Byte is not part of a frame. */
+#define FRAME_PENDING       1     /* Byte was consumed by a frame. */
+#define FRAME_READY         2     /* A valid frame was completed. */
+#define FRAME_ERROR         3     /* A corrupt frame was dropped. */
+
+/**
+ * Represents a decoded frame.
+ */
+struct frame
+{
+    uint8_t command;
+    uint8_t sequence;
+    uint8_t length;   /* Payload length in bytes. */
+    uint8_t payload[FRAME_MAX_PAYLOAD];
+};
+
+/**
+ * Functions.
+ */
+uint16_t crc16Update(uint16_t crc, uint8_t data);
+int cobsEncode(const uint8_t* in, int length, uint8_t* out);
+int cobsDecode(const uint8_t* in, int length, uint8_t* out);
+int frameReceive(uint8_t dataIn, struct frame* f);
+int frameEncode(const struct frame* f, uint8_t* out);
+int16_t frameGetInt16(const struct frame* f, int offset);
+void framePutInt16(struct frame* f, int offset, int16_t value);
+
+#endif /* PROTOCOL_H */
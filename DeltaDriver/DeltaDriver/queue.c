@@ -0,0 +1,110 @@
+#include <stdint.h>
+#include "queue.h"
+
+#ifdef __AVR__
+#include <util/atomic.h>
+#endif
+
+/**
+ * Implements the setpoint queue as a ring buffer. Only queuePush writes
+ * 'head' and only queuePop writes 'tail', and both are single bytes, so each
+ * side always sees a consistent count.
+ */
+
+static struct setpoint slots[QUEUE_SIZE];
+static volatile uint8_t head = 0; /* Next slot to write. */
+static volatile uint8_t tail = 0; /* Next slot to read. */
+
+/**
+ * Empties the queue. Must not run concurrently with queuePush or queuePop.
+ */
+void queueReset(void)
+{
+    head = 0;
+    tail = 0;
+}
+
+/**
+ * Appends a copy of 's' to the queue. Returns 0 if the queue is full.
+ */
+int queuePush(const struct setpoint* s)
+{
+    uint8_t next = (head + 1) & (QUEUE_SIZE - 1);
+
+    if (next == tail)
+        return 0;
+    slots[head] = *s;
+    head = next; /* Publish only once the slot is written. */
+    return 1;
+}
+
+/**
+ * Appends copies of the 'n' setpoints of 's' to the queue, all or none: the
+ * consumer sees them only once every one is written. Returns 0 if there is
+ * not room for all of them.
+ */
+int queuePushBlock(const struct setpoint* s, uint8_t n)
+{
+    uint8_t next = head;
+    uint8_t i;
+
+    if (n > queueFree())
+        return 0;
+    for (i = 0; i < n; i++)
+    {
+        slots[next] = s[i];
+        next = (next + 1) & (QUEUE_SIZE - 1);
+    }
+    head = next;
+    return 1;
+}
+
+/**
+ * Removes the oldest setpoint into 's'. Returns 0 if the queue is empty.
+ */
+int queuePop(struct setpoint* s)
+{
+    if (tail == head)
+        return 0;
+    *s = slots[tail];
+    tail = (tail + 1) & (QUEUE_SIZE - 1);
+    return 1;
+}
+
+/**
+ * Returns the slot index of the setpoint pushed last. Only for the producer.
+ */
+uint8_t queueLastIndex(void)
+{
+    return (head - 1) & (QUEUE_SIZE - 1);
+}
+
+/**
+ * Sets the planned exit velocity of the setpoint in slot 'index'. Only for
+ * the producer; harmless if the consumer has already taken the setpoint.
+ */
+void queueSetExit(uint8_t index, uint16_t exit)
+{
+#ifdef __AVR__
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) /* The consumer never sees half. */
+#endif
+    {
+        slots[index].exit = exit;
+    }
+}
+
+/**
+ * Returns the number of queued setpoints.
+ */
+uint8_t queueCount(void)
+{
+    return (head - tail) & (QUEUE_SIZE - 1);
+}
+
+/**
+ * Returns the number of setpoints that can still be pushed.
+ */
+uint8_t queueFree(void)
+{
+    return QUEUE_CAPACITY - queueCount();
+}
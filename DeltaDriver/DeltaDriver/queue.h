@@ -0,0 +1,62 @@
+/**
+ * Implements the setpoint queue between the command protocols and the servos.
+ */
+
+#ifndef __QUEUE_H
+#define __QUEUE_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** QUEUE SPECS. */
+/* One producer (the command parsers) and one consumer (the servo update) may
+   use the queue concurrently without locking. QUEUE_SIZE must be a power of
+   two, and one slot is kept empty to tell a full queue from an empty one. */
+#define QUEUE_SIZE          32
+#define QUEUE_CAPACITY      (QUEUE_SIZE - 1)
+
+/** SETPOINT TYPES. */
+#define SETPOINT_POSITION   1     /* x, y, z in thousandths of an inch. */
+#define SETPOINT_TICKS      2     /* Goal ticks of servos 1, 2, 3. */
+#define SETPOINT_LINE       3     /* Line to x, y, z in thousandths of an
+                                     inch, interpolated on board. */
+#define SETPOINT_CONTROL    4     /* Inner control point x, y, z of the
+                                     SETPOINT_BEZIER that follows. */
+#define SETPOINT_BEZIER     5     /* Cubic Bezier to x, y, z in thousandths
+                                     of an inch, after two SETPOINT_CONTROL. */
+#define SETPOINT_ARC_CW     6     /* Clockwise arc to x, y, z in thousandths
+                                     of an inch, about the centre x, y of the
+                                     SETPOINT_CONTROL before it. */
+#define SETPOINT_ARC_CCW    7     /* Likewise, counter-clockwise. */
+
+/**
+ * Represents one queued setpoint.
+ */
+struct setpoint
+{
+    uint8_t type;
+    int16_t values[3];
+    uint16_t param;     /* POSITION, TICKS: ms until the next setpoint.
+                           LINE, ARC: feed rate in thousandths of an inch/s.
+                           BEZIER: duration in ms. */
+    uint16_t exit;      /* LINE, ARC: velocity at the end, in thousandths of
+                           an inch/s, raised by the planner as segments
+                           follow. */
+};
+
+/**
+ * Functions.
+ */
+void queueReset(void);
+int queuePush(const struct setpoint* s);
+int queuePushBlock(const struct setpoint* s, uint8_t n);
+int queuePop(struct setpoint* s);
+uint8_t queueLastIndex(void);
+void queueSetExit(uint8_t index, uint16_t exit);
+uint8_t queueCount(void);
+uint8_t queueFree(void);
+
+#endif /* QUEUE_H */
@@ -0,0 +1,131 @@
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stdint.h>
+#include "scheduler.h"
+
+/**
+ * Implements the fixed-rate servo update tick. Timer 1 runs in CTC mode, and
+ * its compare match interrupt calls the tick function. The interrupt is
+ * non-blocking, so the serial and Dynamixel receive interrupts keep running
+ * while a tick talks to the servos. A tick that is still running when the
+ * next match arrives is not re-entered; the match is counted as an overrun.
+ */
+
+static void (*tickFunction)(void) = 0;
+static volatile uint8_t tickBusy = 0;
+static volatile uint8_t missed = 0;     /* Matches during the current tick. */
+static volatile uint16_t periodUs = 0;  /* Tick period in microseconds. */
+static volatile uint32_t now = 0;       /* Microseconds of ticks so far. */
+static volatile struct schedStats stats;
+
+/**
+ * Starts calling 'tick' from the timer interrupt 'hz' times per second
+ * (clamped to SCHED_MIN_HZ - SCHED_MAX_HZ), and clears the statistics. Also
+ * changes the rate of a running scheduler.
+ */
+void schedulerStart(uint16_t hz, void (*tick)(void))
+{
+    if (hz < SCHED_MIN_HZ)
+        hz = SCHED_MIN_HZ;
+    if (hz > SCHED_MAX_HZ)
+        hz = SCHED_MAX_HZ;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        TIMSK1 &= ~(1 << OCIE1A);
+        tickFunction = tick;
+        TCCR1A = 0;
+        TCCR1B = (1 << WGM12) | (1 << CS11); /* CTC, clock / 8. */
+        OCR1A = (uint16_t) (SCHED_TIMER_HZ / hz - 1);
+        periodUs = (uint16_t) (1000000L / hz);
+        TCNT1 = 0;
+        TIFR1 = (1 << OCF1A);
+        stats.rate = hz;
+        schedulerClearStats();
+        TIMSK1 |= (1 << OCIE1A);
+    }
+}
+
+/**
+ * Returns the tick period in microseconds. Meant to be called from the tick.
+ */
+uint16_t schedulerPeriod(void)
+{
+    return periodUs;
+}
+
+/**
+ * Returns the time in microseconds since the scheduler first started, to the
+ * last timer match. Wraps after about 71 minutes.
+ */
+uint32_t schedulerTime(void)
+{
+    uint32_t time;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        time = now;
+    }
+    return time;
+}
+
+/**
+ * Copies the tick statistics into 'out'.
+ */
+void schedulerGetStats(struct schedStats* out)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        *out = *(struct schedStats*) &stats;
+    }
+}
+
+/**
+ * Clears the tick statistics, except for the rate.
+ */
+void schedulerClearStats(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        stats.ticks = 0;
+        stats.overruns = 0;
+        stats.maxLatency = 0;
+        stats.maxDuration = 0;
+        stats.lastDuration = 0;
+    }
+}
+
+ISR(TIMER1_COMPA_vect, ISR_NOBLOCK)
+{
+    uint16_t start;
+    uint32_t duration;
+
+    start = TCNT1; /* Counts since the match: the latency of this tick. */
+    now += periodUs;
+    if (tickBusy)
+    {
+        missed++;
+        stats.overruns++;
+        return;
+    }
+    tickBusy = 1;
+    missed = 0;
+    if (start / 2 > stats.maxLatency)
+        stats.maxLatency = start / 2;
+
+    tickFunction();
+
+    /* The counter restarts at every match, so add a period per missed one. */
+    cli();
+    duration = (uint32_t) missed * (OCR1A + 1) + TCNT1 - start;
+    sei();
+    duration /= 2;
+    if (duration > 0xFFFF)
+        duration = 0xFFFF;
+    stats.lastDuration = (uint16_t) duration;
+    if (stats.lastDuration > stats.maxDuration)
+        stats.maxDuration = stats.lastDuration;
+    stats.ticks++;
+    tickBusy = 0;
+}
@@ -0,0 +1,44 @@
+/**
+ * Implements the fixed-rate servo update tick on hardware timer 1.
+ */
+
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** TICK RATE. */
+/* Timer 1 counts at F_CPU / 8 = 2 MHz, so a period fits in 16 bits down to
+   31 Hz. The rate can be changed at run time within these limits. */
+#define SCHED_DEFAULT_HZ    100
+#define SCHED_MIN_HZ        100
+#define SCHED_MAX_HZ        500
+#define SCHED_TIMER_HZ      2000000L  /* Timer 1 clock in Hz. */
+
+/**
+ * Represents the timing statistics of the tick. Times are in microseconds.
+ */
+struct schedStats
+{
+    uint16_t rate;          /* Tick rate in Hz. */
+    uint16_t ticks;         /* Ticks run (wraps). */
+    uint16_t overruns;      /* Ticks skipped because the last was still running. */
+    uint16_t maxLatency;    /* Worst delay from timer match to tick start. */
+    uint16_t maxDuration;   /* Worst tick run time. */
+    uint16_t lastDuration;  /* Run time of the last tick. */
+};
+
+/**
+ * Functions.
+ */
+void schedulerStart(uint16_t hz, void (*tick)(void));
+uint16_t schedulerPeriod(void);
+uint32_t schedulerTime(void);
+void schedulerGetStats(struct schedStats* stats);
+void schedulerClearStats(void);
+
+#endif /* SCHEDULER_H */
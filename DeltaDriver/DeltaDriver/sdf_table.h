@@ -0,0 +1,791 @@
+/**
+ * Signed-distance field of the pen workspace, in thousandths of an inch.
+ * Generated by writeSdfTable() in workspace.c -- do not edit.
+ */
+
+static const int16_t SDF_TABLE[27][27][23] PROGMEM =
+{
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1500,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1250,-1250,-1250,-1250,-1250,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-1000,-1000,-1000,-1000,-1000,-1000,-1000,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-750,-750,-750,-750,-750,-750,-750,-750,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-500,-500,-500,-500,-500,-500,-500,-500,-500,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,500},
+        {1521,1275,1031,791,559,354,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,354,559},
+        {1581,1346,1118,901,707,559,500,500,500,500,500,500,500,500,500,500,500,500,500,500,500,559,707}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1743,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1493,-1493,-1493,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1243,-1243,-1243,-1243,-1243,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-994,-994,-994,-994,-994,-994,-994,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-744,-744,-744,-744,-744,-744,-744,-744,-744,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,0,250,500},
+        {1500,1250,1000,750,500,250,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,250,500},
+        {1522,1276,1032,792,561,357,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,357,561},
+        {1583,1348,1120,904,711,563,505,505,505,505,505,505,505,505,505,505,505,505,505,505,505,563,711}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1721,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1472,-1472,-1472,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1224,-1224,-1224,-1224,-1224,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-975,-975,-975,-975,-975,-975,-975,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-726,-726,-726,-726,-726,-726,-726,-726,-726,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-477,-477,-477,-477,-477,-477,-477,-477,-477,-477,-477,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,0,250,500},
+        {1500,1250,1000,750,500,251,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,251,500},
+        {1524,1279,1036,797,568,368,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,368,568},
+        {1587,1354,1127,912,721,576,519,519,519,519,519,519,519,519,519,519,519,519,519,519,519,576,721}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1684,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1438,-1438,-1438,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1191,-1191,-1191,-1191,-1191,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-944,-944,-944,-944,-944,-944,-944,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-697,-697,-697,-697,-697,-697,-697,-697,-697,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,0,250,500},
+        {1501,1251,1001,751,502,254,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,254,502},
+        {1529,1284,1043,806,580,387,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,387,580},
+        {1595,1363,1138,926,738,598,543,543,543,543,543,543,543,543,543,543,543,543,543,543,543,598,738}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1634,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1390,-1390,-1390,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1146,-1146,-1146,-1146,-1146,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-901,-901,-901,-901,-901,-901,-901,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-656,-656,-656,-656,-656,-656,-656,-656,-656,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,0,250,500},
+        {1502,1253,1003,755,507,263,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,263,507},
+        {1536,1293,1053,819,599,414,329,329,329,329,329,329,329,329,329,329,329,329,329,329,329,414,599},
+        {1607,1377,1154,946,763,628,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,628,763}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1500,-1570,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1330,-1330,-1330,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1088,-1088,-1088,-1088,-1088,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-846,-846,-846,-846,-846,-846,-846,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-603,-603,-603,-603,-603,-603,-603,-603,-603,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-360,-360,-360,-360,-360,-360,-360,-360,-360,-360,-360,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,0,250,500},
+        {1506,1257,1008,761,516,281,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,281,516},
+        {1546,1305,1068,838,624,450,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,450,624},
+        {1623,1395,1176,973,796,668,619,619,619,619,619,619,619,619,619,619,619,619,619,619,619,668,796}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1728,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1493,-1493,-1493,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1250,-1257,-1257,-1257,-1250,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-1000,-1019,-1019,-1019,-1019,-1019,-1000,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-750,-780,-780,-780,-780,-780,-780,-780,-750,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-500,-540,-540,-540,-540,-540,-540,-540,-540,-540,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,0,250,500},
+        {1511,1264,1017,772,533,311,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,311,533},
+        {1560,1321,1088,863,658,495,427,427,427,427,427,427,427,427,427,427,427,427,427,427,427,495,658},
+        {1643,1419,1204,1006,837,716,671,671,671,671,671,671,671,671,671,671,671,671,671,671,671,716,837}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1634,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1404,-1404,-1404,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1172,-1172,-1172,-1172,-1172,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-938,-938,-938,-938,-938,-938,-938,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-703,-703,-703,-703,-703,-703,-703,-703,-703,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-466,-466,-466,-466,-466,-466,-466,-466,-466,-466,-466,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,0,250,500},
+        {1500,1250,1000,750,500,250,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,250,500},
+        {1521,1275,1031,791,559,354,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,354,559},
+        {1578,1343,1114,896,700,550,490,490,490,490,490,490,490,490,490,490,490,490,490,490,490,550,700},
+        {1669,1448,1239,1048,886,773,731,731,731,731,731,731,731,731,731,731,731,731,731,731,731,773,886}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1500,-1528,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1250,-1303,-1303,-1303,-1250,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-1000,-1076,-1076,-1076,-1076,-1076,-1000,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-750,-846,-846,-846,-846,-846,-846,-846,-750,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-615,-615,-615,-615,-615,-615,-615,-615,-615,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,0,250,500},
+        {1503,1253,1004,755,508,265,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,265,508},
+        {1535,1291,1051,817,596,410,325,325,325,325,325,325,325,325,325,325,325,325,325,325,325,410,596},
+        {1602,1371,1147,937,752,615,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,615,752},
+        {1700,1484,1281,1097,944,839,801,801,801,801,801,801,801,801,801,801,801,801,801,801,801,839,944}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1627,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1411,-1411,-1411,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1191,-1191,-1191,-1191,-1191,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-969,-969,-969,-969,-969,-969,-969,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-744,-744,-744,-744,-744,-744,-744,-744,-744,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-500,-517,-517,-517,-517,-517,-517,-517,-517,-517,-500,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-250,-288,-288,-288,-288,-288,-288,-288,-288,-288,-288,-288,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,0,250,500},
+        {1510,1262,1015,770,530,305,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,305,530},
+        {1554,1315,1080,854,645,479,408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,479,645},
+        {1632,1406,1189,988,814,690,643,643,643,643,643,643,643,643,643,643,643,643,643,643,643,690,814},
+        {1738,1528,1331,1155,1011,913,878,878,878,878,878,878,878,878,878,878,878,878,878,878,878,913,1011}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1699,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1493,-1493,-1493,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1283,-1283,-1283,-1250,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1069,-1069,-1069,-1069,-1069,-1000,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-750,-852,-852,-852,-852,-852,-852,-852,-750,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-632,-632,-632,-632,-632,-632,-632,-632,-632,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,0,250,500},
+        {1501,1251,1001,751,502,253,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,253,502},
+        {1524,1279,1036,797,568,368,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,368,568},
+        {1581,1346,1118,901,707,559,500,500,500,500,500,500,500,500,500,500,500,500,500,500,500,559,707},
+        {1669,1448,1239,1048,886,773,731,731,731,731,731,731,731,731,731,731,731,731,731,731,731,773,886},
+        {1783,1579,1389,1222,1086,996,964,964,964,964,964,964,964,964,964,964,964,964,964,964,964,996,1086}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1743,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1549,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1350,-1350,-1350,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1146,-1146,-1146,-1146,-1146,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-938,-938,-938,-938,-938,-938,-938,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-726,-726,-726,-726,-726,-726,-726,-726,-726,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-500,-511,-511,-511,-511,-511,-511,-511,-511,-511,-500,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-250,-294,-294,-294,-294,-294,-294,-294,-294,-294,-294,-294,-250,0,250,500},
+        {1500,1250,1000,750,500,250,0,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,0,250,500},
+        {1507,1259,1011,765,522,291,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,291,522},
+        {1546,1305,1068,838,624,450,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,450,624},
+        {1616,1387,1166,961,781,650,600,600,600,600,600,600,600,600,600,600,600,600,600,600,600,650,781},
+        {1713,1499,1298,1117,967,865,828,828,828,828,828,828,828,828,828,828,828,828,828,828,828,865,967},
+        {1835,1638,1456,1297,1170,1087,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1087,1170}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1577,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1390,-1390,-1390,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1198,-1198,-1198,-1198,-1198,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1000,-1000,-1000,-1000,-1000,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-798,-798,-798,-798,-798,-798,-798,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-592,-592,-592,-592,-592,-592,-592,-592,-592,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,0,250,500},
+        {1501,1251,1001,751,502,254,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,254,502},
+        {1523,1278,1035,795,566,364,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,364,566},
+        {1577,1341,1112,893,697,546,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,546,697},
+        {1659,1437,1225,1032,867,751,708,708,708,708,708,708,708,708,708,708,708,708,708,708,708,751,867},
+        {1766,1560,1367,1197,1058,966,933,933,933,933,933,933,933,933,933,933,933,933,933,933,933,966,1058},
+        {1896,1705,1531,1380,1262,1186,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1186,1262}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1743,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1577,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1404,-1404,-1404,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1224,-1224,-1224,-1224,-1224,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1038,-1038,-1038,-1038,-1038,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-846,-846,-846,-846,-846,-846,-846,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-650,-650,-650,-650,-650,-650,-650,-650,-650,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,0,250,500},
+        {1346,1250,1000,750,500,250,0,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,0,250,500},
+        {1510,1262,1015,770,530,305,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,305,530},
+        {1549,1309,1073,845,633,462,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,462,633},
+        {1617,1389,1169,964,785,655,605,605,605,605,605,605,605,605,605,605,605,605,605,605,605,655,785},
+        {1711,1497,1296,1114,964,861,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,861,964},
+        {1828,1629,1446,1286,1158,1074,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1074,1158},
+        {1964,1780,1614,1473,1362,1292,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1292,1362}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1699,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1549,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1390,-1390,-1390,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1224,-1224,-1224,-1224,-1224,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1050,-1050,-1050,-1050,-1050,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-870,-870,-870,-870,-870,-870,-870,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-685,-685,-685,-685,-685,-685,-685,-685,-685,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,0,250,500},
+        {1346,1254,1005,757,511,270,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,270,511},
+        {1532,1288,1047,811,588,398,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,398,588},
+        {1587,1354,1127,912,721,576,519,519,519,519,519,519,519,519,519,519,519,519,519,519,519,576,721},
+        {1669,1448,1239,1048,886,773,731,731,731,731,731,731,731,731,731,731,731,731,731,731,731,773,886},
+        {1774,1568,1377,1207,1070,979,946,946,946,946,946,946,946,946,946,946,946,946,946,946,946,979,1070},
+        {1898,1708,1534,1384,1266,1190,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1190,1266},
+        {2040,1864,1706,1573,1470,1405,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1405,1470}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1627,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1493,-1493,-1493,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1350,-1350,-1350,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1198,-1198,-1198,-1198,-1198,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1038,-1038,-1038,-1038,-1038,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-870,-870,-870,-870,-870,-870,-870,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-697,-697,-697,-697,-697,-697,-697,-697,-697,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-517,-517,-517,-517,-517,-517,-517,-517,-517,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-332,-332,-332,-332,-332,-332,-332,-332,-332,-332,-332,-250,0,250,500},
+        {901,791,750,750,500,250,0,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,0,250,500},
+        {1118,1031,1000,752,503,255,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,255,503},
+        {1346,1275,1031,791,559,354,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,354,559},
+        {1567,1329,1097,876,674,516,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,516,674},
+        {1637,1412,1196,997,825,703,657,657,657,657,657,657,657,657,657,657,657,657,657,657,657,703,825},
+        {1731,1520,1322,1145,999,900,865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,900,999},
+        {1846,1649,1469,1311,1186,1104,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1104,1186},
+        {1978,1795,1631,1491,1382,1313,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1313,1382},
+        {2124,1956,1806,1681,1585,1525,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1525,1585}
+    },
+    {
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1728,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1634,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1500,-1528,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1411,-1411,-1411,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1250,-1283,-1283,-1283,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1146,-1146,-1146,-1146,-1146,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-1000,-1000,-1000,-1000,-1000,-1000,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-500,-250,0,-250,-500,-750,-846,-846,-846,-846,-846,-846,-846,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-685,-685,-685,-685,-685,-685,-685,-685,-685,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-517,-517,-517,-517,-517,-517,-517,-517,-517,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-343,-343,-343,-343,-343,-343,-343,-343,-343,-343,-343,-250,0,250,500},
+        {707,559,500,500,500,250,0,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,0,250,500},
+        {901,791,750,750,500,251,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,251,500},
+        {1118,1031,1000,779,542,326,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,326,542},
+        {1346,1275,1078,851,642,474,403,403,403,403,403,403,403,403,403,403,403,403,403,403,403,474,642},
+        {1581,1387,1166,961,781,650,600,600,600,600,600,600,600,600,600,600,600,600,600,600,600,650,781},
+        {1700,1484,1281,1097,944,839,801,801,801,801,801,801,801,801,801,801,801,801,801,801,801,839,944},
+        {1805,1604,1417,1254,1122,1035,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1035,1122},
+        {1928,1740,1571,1425,1310,1237,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1237,1310},
+        {2066,1892,1737,1606,1506,1442,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1442,1506},
+        {2217,2056,1914,1796,1707,1651,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1651,1707}
+    },
+    {
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1750,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1743,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1721,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1684,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1634,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1500,-1570,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1493,-1493,-1493,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1404,-1404,-1404,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1250,-1303,-1303,-1303,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1191,-1191,-1191,-1191,-1191,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-1000,-1069,-1069,-1069,-1069,-1069,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-938,-938,-938,-938,-938,-938,-938,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-750,-798,-798,-798,-798,-798,-798,-798,-750,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-500,-650,-650,-650,-650,-650,-650,-650,-650,-650,-500,-250,0,250,500},
+        {500,250,0,-250,-250,-250,0,-250,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-332,-332,-332,-332,-332,-332,-332,-332,-332,-332,-332,-250,0,250,500},
+        {559,354,250,250,250,250,0,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,0,250,500},
+        {707,559,500,500,500,250,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,250,500},
+        {901,791,750,750,535,314,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,314,535},
+        {1118,1031,1000,838,624,450,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,450,624},
+        {1346,1275,1147,937,752,615,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,615,752},
+        {1581,1460,1253,1064,905,795,755,755,755,755,755,755,755,755,755,755,755,755,755,755,755,795,905},
+        {1776,1570,1380,1211,1074,983,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,983,1074},
+        {1890,1699,1524,1373,1254,1177,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1177,1254},
+        {2020,1842,1682,1547,1442,1376,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1376,1442},
+        {2163,1998,1851,1729,1636,1578,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1578,1636},
+        {2317,2164,2030,1919,1836,1784,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1784,1836}
+    },
+    {
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1500,-1500,-1500,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1493,-1493,-1493,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1472,-1472,-1472,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1438,-1438,-1438,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1390,-1390,-1390,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1330,-1330,-1330,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1250,-1257,-1257,-1257,-1250,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1172,-1172,-1172,-1172,-1172,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-1000,-1076,-1076,-1076,-1076,-1076,-1000,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-969,-969,-969,-969,-969,-969,-969,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-750,-852,-852,-852,-852,-852,-852,-852,-750,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-726,-726,-726,-726,-726,-726,-726,-726,-726,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-500,-592,-592,-592,-592,-592,-592,-592,-592,-592,-500,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-250,0,250,500},
+        {500,250,0,0,0,0,0,-250,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-250,0,250,500},
+        {500,250,0,0,0,0,0,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,-142,0,250,500},
+        {559,354,250,250,250,250,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,251,500},
+        {707,559,500,500,500,314,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,314,535},
+        {901,791,750,750,618,442,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,442,618},
+        {1118,1031,1000,926,738,598,543,543,543,543,543,543,543,543,543,543,543,543,543,543,543,598,738},
+        {1346,1275,1236,1044,882,769,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,769,882},
+        {1581,1521,1355,1183,1042,948,915,915,915,915,915,915,915,915,915,915,915,915,915,915,915,948,1042},
+        {1820,1669,1491,1337,1214,1134,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1134,1214},
+        {1986,1805,1641,1502,1394,1325,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1325,1394},
+        {2121,1953,1803,1677,1581,1521,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1521,1581},
+        {2268,2111,1974,1859,1773,1720,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1720,1773},
+        {2425,2279,2152,2048,1970,1922,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1922,1970}
+    },
+    {
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1250,-1250,-1250,-1250,-1250,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1243,-1243,-1243,-1243,-1243,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1224,-1224,-1224,-1224,-1224,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1191,-1191,-1191,-1191,-1191,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1146,-1146,-1146,-1146,-1146,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1088,-1088,-1088,-1088,-1088,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-1000,-1019,-1019,-1019,-1019,-1019,-1000,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-938,-938,-938,-938,-938,-938,-938,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-750,-846,-846,-846,-846,-846,-846,-846,-750,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-744,-744,-744,-744,-744,-744,-744,-744,-744,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-632,-632,-632,-632,-632,-632,-632,-632,-632,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-500,-511,-511,-511,-511,-511,-511,-511,-511,-511,-500,-250,0,250,500},
+        {559,354,250,250,250,250,0,-250,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-250,0,250,500},
+        {559,354,250,250,250,250,0,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,0,250,500},
+        {559,354,250,250,250,250,0,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,-100,0,250,500},
+        {559,354,250,250,250,250,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,255,503},
+        {612,433,354,354,354,326,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,326,542},
+        {750,612,559,559,559,450,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,450,624},
+        {935,829,791,791,738,598,543,543,543,543,543,543,543,543,543,543,543,543,543,543,543,598,738},
+        {1146,1061,1031,1031,875,760,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,760,875},
+        {1369,1299,1275,1169,1027,931,897,897,897,897,897,897,897,897,897,897,897,897,897,897,897,931,1027},
+        {1601,1541,1472,1315,1190,1108,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1108,1190},
+        {1837,1780,1614,1473,1362,1292,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1292,1362},
+        {2077,1921,1768,1640,1542,1479,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1479,1542},
+        {2232,2072,1932,1815,1727,1671,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1671,1727},
+        {2382,2233,2103,1996,1917,1867,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1867,1917},
+        {2541,2402,2281,2183,2111,2066,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2066,2111}
+    },
+    {
+        {707,559,500,500,500,250,0,-250,-500,-750,-1000,-1000,-1000,-1000,-1000,-1000,-1000,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-994,-994,-994,-994,-994,-994,-994,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-975,-975,-975,-975,-975,-975,-975,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-944,-944,-944,-944,-944,-944,-944,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-901,-901,-901,-901,-901,-901,-901,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-846,-846,-846,-846,-846,-846,-846,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-750,-780,-780,-780,-780,-780,-780,-780,-750,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-703,-703,-703,-703,-703,-703,-703,-703,-703,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-615,-615,-615,-615,-615,-615,-615,-615,-615,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-500,-517,-517,-517,-517,-517,-517,-517,-517,-517,-500,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-250,0,250,500},
+        {707,559,500,500,500,250,0,-250,-294,-294,-294,-294,-294,-294,-294,-294,-294,-294,-294,-250,0,250,500},
+        {707,559,500,500,500,250,0,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,-169,0,250,500},
+        {707,559,500,500,500,250,0,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,-37,0,250,500},
+        {707,559,500,500,500,270,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,270,511},
+        {707,559,500,500,500,354,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,354,559},
+        {750,612,559,559,559,474,403,403,403,403,403,403,403,403,403,403,403,403,403,403,403,474,642},
+        {866,750,707,707,707,615,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,615,752},
+        {1031,935,901,901,882,769,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,769,882},
+        {1225,1146,1118,1118,1027,931,897,897,897,897,897,897,897,897,897,897,897,897,897,897,897,931,1027},
+        {1436,1369,1346,1308,1182,1100,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1100,1182},
+        {1658,1601,1581,1458,1346,1275,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1275,1346},
+        {1887,1837,1747,1617,1518,1455,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1455,1518},
+        {2121,2046,1904,1785,1695,1639,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1639,1695},
+        {2351,2200,2068,1959,1878,1827,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1827,1878},
+        {2503,2362,2240,2140,2065,2019,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2019,2065},
+        {2663,2531,2417,2325,2257,2215,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2215,2257}
+    },
+    {
+        {901,791,750,750,500,250,0,-250,-500,-750,-750,-750,-750,-750,-750,-750,-750,-750,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-744,-744,-744,-744,-744,-744,-744,-744,-744,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-726,-726,-726,-726,-726,-726,-726,-726,-726,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-697,-697,-697,-697,-697,-697,-697,-697,-697,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-656,-656,-656,-656,-656,-656,-656,-656,-656,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-603,-603,-603,-603,-603,-603,-603,-603,-603,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-500,-540,-540,-540,-540,-540,-540,-540,-540,-540,-500,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-466,-466,-466,-466,-466,-466,-466,-466,-466,-466,-466,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-382,-250,0,250,500},
+        {901,791,750,750,500,250,0,-250,-288,-288,-288,-288,-288,-288,-288,-288,-288,-288,-288,-250,0,250,500},
+        {901,791,750,750,500,250,0,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,-185,0,250,500},
+        {901,791,750,750,500,250,0,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,-73,0,250,500},
+        {901,791,750,750,502,254,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,254,502},
+        {901,791,750,750,530,305,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,305,530},
+        {901,791,750,750,588,398,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,398,588},
+        {901,791,750,750,674,516,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,516,674},
+        {935,829,791,791,781,650,600,600,600,600,600,600,600,600,600,600,600,600,600,600,600,650,781},
+        {1031,935,901,901,901,795,755,755,755,755,755,755,755,755,755,755,755,755,755,755,755,795,905},
+        {1173,1090,1061,1061,1042,948,915,915,915,915,915,915,915,915,915,915,915,915,915,915,915,948,1042},
+        {1346,1275,1250,1250,1190,1108,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1080,1108,1190},
+        {1541,1479,1458,1458,1346,1275,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1250,1275,1346},
+        {1750,1696,1677,1610,1510,1446,1425,1425,1425,1425,1425,1425,1425,1425,1425,1425,1425,1425,1425,1425,1425,1446,1510},
+        {1969,1920,1890,1770,1680,1623,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1623,1680},
+        {2194,2151,2047,1937,1855,1804,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1804,1855},
+        {2424,2335,2212,2110,2035,1988,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1988,2035},
+        {2632,2498,2382,2289,2219,2177,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2177,2219},
+        {2792,2667,2559,2472,2408,2369,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2369,2408}
+    },
+    {
+        {1118,1031,1000,750,500,250,0,-250,-500,-500,-500,-500,-500,-500,-500,-500,-500,-500,-500,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-494,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-477,-477,-477,-477,-477,-477,-477,-477,-477,-477,-477,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-449,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-410,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-360,-360,-360,-360,-360,-360,-360,-360,-360,-360,-360,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-250,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-299,-250,0,250,500},
+        {1118,1031,1000,750,500,250,0,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,0,250,500},
+        {1118,1031,1000,750,500,250,0,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,-148,0,250,500},
+        {1118,1031,1000,750,500,250,0,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,0,250,500},
+        {1118,1031,1000,751,502,253,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,253,502},
+        {1118,1031,1000,765,522,291,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,291,522},
+        {1118,1031,1000,795,566,364,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,364,566},
+        {1118,1031,1000,845,633,462,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,462,633},
+        {1118,1031,1000,912,721,576,519,519,519,519,519,519,519,519,519,519,519,519,519,519,519,576,721},
+        {1118,1031,1000,997,825,703,657,657,657,657,657,657,657,657,657,657,657,657,657,657,657,703,825},
+        {1146,1061,1031,1031,944,839,801,801,801,801,801,801,801,801,801,801,801,801,801,801,801,839,944},
+        {1225,1146,1118,1118,1074,983,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,983,1074},
+        {1346,1275,1250,1250,1214,1134,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1106,1134,1214},
+        {1500,1436,1414,1414,1362,1292,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1292,1362},
+        {1677,1620,1601,1601,1518,1455,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1433,1455,1518},
+        {1871,1820,1803,1770,1680,1623,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1603,1623,1680},
+        {2077,2031,2016,1930,1847,1796,1778,1778,1778,1778,1778,1778,1778,1778,1778,1778,1778,1778,1778,1778,1778,1796,1847},
+        {2291,2250,2198,2096,2020,1973,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1973,2020},
+        {2512,2475,2362,2267,2197,2154,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2154,2197},
+        {2739,2640,2531,2443,2379,2339,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2339,2379},
+        {2928,2808,2706,2624,2564,2527,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2527,2564}
+    },
+    {
+        {1346,1250,1000,750,500,250,0,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,-250,0,250,500},
+        {1346,1250,1000,750,500,250,0,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,-245,0,250,500},
+        {1346,1250,1000,750,500,250,0,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,-228,0,250,500},
+        {1346,1250,1000,750,500,250,0,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,-201,0,250,500},
+        {1346,1250,1000,750,500,250,0,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,-164,0,250,500},
+        {1346,1250,1000,750,500,250,0,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,-116,0,250,500},
+        {1346,1250,1000,750,500,250,0,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,0,250,500},
+        {1346,1250,1000,750,500,250,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,250,500},
+        {1346,1253,1004,755,508,265,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,265,508},
+        {1346,1262,1015,770,530,305,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,305,530},
+        {1346,1275,1036,797,568,368,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,368,568},
+        {1346,1275,1068,838,624,450,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,450,624},
+        {1346,1275,1112,893,697,546,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,546,697},
+        {1346,1275,1169,964,785,655,605,605,605,605,605,605,605,605,605,605,605,605,605,605,605,655,785},
+        {1346,1275,1239,1048,886,773,731,731,731,731,731,731,731,731,731,731,731,731,731,731,731,773,886},
+        {1346,1275,1250,1145,999,900,865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,900,999},
+        {1369,1299,1275,1254,1122,1035,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1035,1122},
+        {1436,1369,1346,1346,1254,1177,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1150,1177,1254},
+        {1541,1479,1458,1458,1394,1325,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1302,1325,1394},
+        {1677,1620,1601,1601,1542,1479,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1458,1479,1542},
+        {1837,1785,1768,1768,1695,1639,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1620,1639,1695},
+        {2016,1969,1953,1937,1855,1804,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1786,1804,1855},
+        {2208,2165,2151,2096,2020,1973,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1957,1973,2020},
+        {2411,2372,2355,2260,2190,2146,2132,2132,2132,2132,2132,2132,2132,2132,2132,2132,2132,2132,2132,2132,2132,2146,2190},
+        {2622,2586,2518,2429,2364,2324,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2324,2364},
+        {2839,2789,2686,2603,2542,2505,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2505,2542},
+        {3062,2956,2859,2781,2725,2690,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2690,2725}
+    },
+    {
+        {1500,1250,1000,750,500,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,500},
+        {1500,1250,1000,750,500,250,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,250,500},
+        {1500,1250,1000,750,500,251,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,251,500},
+        {1501,1251,1001,751,502,254,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,254,502},
+        {1502,1253,1003,755,507,263,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,263,507},
+        {1506,1257,1008,761,516,281,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,281,516},
+        {1511,1264,1017,772,533,311,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,311,533},
+        {1521,1275,1031,791,559,354,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,354,559},
+        {1535,1291,1051,817,596,410,325,325,325,325,325,325,325,325,325,325,325,325,325,325,325,410,596},
+        {1554,1315,1080,854,645,479,408,408,408,408,408,408,408,408,408,408,408,408,408,408,408,479,645},
+        {1581,1346,1118,901,707,559,500,500,500,500,500,500,500,500,500,500,500,500,500,500,500,559,707},
+        {1581,1387,1166,961,781,650,600,600,600,600,600,600,600,600,600,600,600,600,600,600,600,650,781},
+        {1581,1437,1225,1032,867,751,708,708,708,708,708,708,708,708,708,708,708,708,708,708,708,751,867},
+        {1581,1497,1296,1114,964,861,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,861,964},
+        {1581,1521,1377,1207,1070,979,946,946,946,946,946,946,946,946,946,946,946,946,946,946,946,979,1070},
+        {1581,1521,1469,1311,1186,1104,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1104,1186},
+        {1601,1541,1521,1425,1310,1237,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1237,1310},
+        {1658,1601,1581,1547,1442,1376,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1353,1376,1442},
+        {1750,1696,1677,1677,1581,1521,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1500,1521,1581},
+        {1871,1820,1803,1803,1727,1671,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1653,1671,1727},
+        {2016,1969,1953,1953,1878,1827,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1810,1827,1878},
+        {2179,2136,2121,2110,2035,1988,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1973,1988,2035},
+        {2358,2318,2305,2267,2197,2154,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2139,2154,2197},
+        {2550,2512,2500,2429,2364,2324,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2310,2324,2364},
+        {2750,2716,2679,2596,2535,2498,2485,2485,2485,2485,2485,2485,2485,2485,2485,2485,2485,2485,2485,2485,2485,2498,2535},
+        {2958,2926,2845,2767,2710,2676,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2676,2710},
+        {3172,3108,3016,2943,2889,2857,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2857,2889}
+    },
+    {
+        {1521,1275,1031,791,559,354,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,354,559},
+        {1522,1276,1032,792,561,357,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,357,561},
+        {1524,1279,1036,797,568,368,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,368,568},
+        {1529,1284,1043,806,580,387,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,387,580},
+        {1536,1293,1053,819,599,414,329,329,329,329,329,329,329,329,329,329,329,329,329,329,329,414,599},
+        {1546,1305,1068,838,624,450,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,450,624},
+        {1560,1321,1088,863,658,495,427,427,427,427,427,427,427,427,427,427,427,427,427,427,427,495,658},
+        {1578,1343,1114,896,700,550,490,490,490,490,490,490,490,490,490,490,490,490,490,490,490,550,700},
+        {1602,1371,1147,937,752,615,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,615,752},
+        {1632,1406,1189,988,814,690,643,643,643,643,643,643,643,643,643,643,643,643,643,643,643,690,814},
+        {1669,1448,1239,1048,886,773,731,731,731,731,731,731,731,731,731,731,731,731,731,731,731,773,886},
+        {1713,1499,1298,1117,967,865,828,828,828,828,828,828,828,828,828,828,828,828,828,828,828,865,967},
+        {1766,1560,1367,1197,1058,966,933,933,933,933,933,933,933,933,933,933,933,933,933,933,933,966,1058},
+        {1820,1629,1446,1286,1158,1074,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1045,1074,1158},
+        {1820,1708,1534,1384,1266,1190,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1163,1190,1266},
+        {1820,1768,1631,1491,1382,1313,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1289,1313,1382},
+        {1837,1785,1737,1606,1506,1442,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1442,1506},
+        {1887,1837,1820,1729,1636,1578,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1558,1578,1636},
+        {1969,1920,1904,1859,1773,1720,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1701,1720,1773},
+        {2077,2031,2016,1996,1917,1867,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1850,1867,1917},
+        {2208,2165,2151,2140,2065,2019,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2004,2019,2065},
+        {2358,2318,2305,2289,2219,2177,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2162,2177,2219},
+        {2525,2487,2475,2443,2379,2339,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2325,2339,2379},
+        {2704,2669,2658,2603,2542,2505,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2493,2505,2542},
+        {2894,2861,2845,2767,2710,2676,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2664,2676,2710},
+        {3092,3062,3010,2936,2883,2850,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,2839,2850,2883},
+        {3298,3266,3179,3109,3058,3028,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3028,3058}
+    },
+    {
+        {1581,1346,1118,901,707,559,500,500,500,500,500,500,500,500,500,500,500,500,500,500,500,559,707},
+        {1583,1348,1120,904,711,563,505,505,505,505,505,505,505,505,505,505,505,505,505,505,505,563,711},
+        {1587,1354,1127,912,721,576,519,519,519,519,519,519,519,519,519,519,519,519,519,519,519,576,721},
+        {1595,1363,1138,926,738,598,543,543,543,543,543,543,543,543,543,543,543,543,543,543,543,598,738},
+        {1607,1377,1154,946,763,628,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,628,763},
+        {1623,1395,1176,973,796,668,619,619,619,619,619,619,619,619,619,619,619,619,619,619,619,668,796},
+        {1643,1419,1204,1006,837,716,671,671,671,671,671,671,671,671,671,671,671,671,671,671,671,716,837},
+        {1669,1448,1239,1048,886,773,731,731,731,731,731,731,731,731,731,731,731,731,731,731,731,773,886},
+        {1700,1484,1281,1097,944,839,801,801,801,801,801,801,801,801,801,801,801,801,801,801,801,839,944},
+        {1738,1528,1331,1155,1011,913,878,878,878,878,878,878,878,878,878,878,878,878,878,878,878,913,1011},
+        {1783,1579,1389,1222,1086,996,964,964,964,964,964,964,964,964,964,964,964,964,964,964,964,996,1086},
+        {1835,1638,1456,1297,1170,1087,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1087,1170},
+        {1896,1705,1531,1380,1262,1186,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1186,1262},
+        {1964,1780,1614,1473,1362,1292,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1267,1292,1362},
+        {2040,1864,1706,1573,1470,1405,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1382,1405,1470},
+        {2062,1956,1806,1681,1585,1525,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1504,1525,1585},
+        {2077,2031,1914,1796,1707,1651,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1632,1651,1707},
+        {2121,2077,2030,1919,1836,1784,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1766,1784,1836},
+        {2194,2151,2136,2048,1970,1922,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1906,1922,1970},
+        {2291,2250,2236,2183,2111,2066,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2066,2111},
+        {2411,2372,2358,2325,2257,2215,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2201,2215,2257},
+        {2550,2512,2500,2472,2408,2369,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2355,2369,2408},
+        {2704,2669,2658,2624,2564,2527,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2515,2527,2564},
+        {2872,2839,2828,2781,2725,2690,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2678,2690,2725},
+        {3052,3021,3010,2943,2889,2857,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2846,2857,2889},
+        {3240,3211,3179,3109,3058,3028,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3017,3028,3058},
+        {3437,3410,3345,3279,3231,3202,3192,3192,3192,3192,3192,3192,3192,3192,3192,3192,3192,3192,3192,3192,3192,3202,3231}
+    }
+};
@@ -0,0 +1,135 @@
+#include <stddef.h>
+#include <stdint.h>
+#include "dynamixel.h"
+#include "debuglog.h"
+#include "servoconfig.h"
+
+/**
+ * Implements the start-up configuration of the servos' bus settings. Every
+ * status packet a servo sends, and the delay before it, is bus time the
+ * servo tick waits through. servoConfigure reads each servo's Status Return
+ * Level and Return Delay Time, rewrites whichever differ from
+ * SERVO_STATUS_RETURN and SERVO_RETURN_DELAY in one sync write each, and
+ * records the result both here and in the Dynamixel library, which then
+ * neither waits for packets a servo does not send nor longer than the
+ * slowest servo's return delay.
+ */
+
+static struct servoConfig servos[SERVO_COUNT];
+
+/**
+ * Reads the settings of servo 'id' into 's'. A servo that answers only pings
+ * has status return level 0, and its return delay cannot be read.
+ */
+static void readConfig(uint8_t id, struct servoConfig* s)
+{
+    int value;
+
+    /* Until it is known, assume the servo answers everything. */
+    dxl_set_status_return(id, STATUS_RETURN_ALL);
+    s->present = 1;
+    s->statusReturn = SERVO_UNKNOWN;
+    s->returnDelay = SERVO_UNKNOWN;
+
+    value = dxl_read_byte(id, P_STATUS_RETURN_LEVEL);
+    if (dxl_get_result() != COMM_RXSUCCESS)
+    {
+        dxl_ping(id);
+        if (dxl_get_result() != COMM_RXSUCCESS)
+        {
+            s->present = 0;
+            LOG(LOG_SERVO_MISSING, id);
+            return;
+        }
+        s->statusReturn = STATUS_RETURN_NONE;
+        dxl_set_status_return(id, STATUS_RETURN_NONE);
+        return;
+    }
+    s->statusReturn = (uint8_t) value;
+    dxl_set_status_return(id, value);
+
+    value = dxl_read_byte(id, P_RETURN_DELAY_TIME);
+    if (dxl_get_result() == COMM_RXSUCCESS)
+        s->returnDelay = (uint8_t) value;
+}
+
+/**
+ * Writes 'value' to the register at 'address' of every present servo whose
+ * current setting, at offset 'field' of its struct servoConfig, differs or
+ * could not be read. Returns the number of servos written.
+ */
+static uint8_t writeChanged(uint8_t address, uint8_t field, uint8_t value)
+{
+    int ids[SERVO_COUNT];
+    int values[SERVO_COUNT];
+    uint8_t i;
+    uint8_t n = 0;
+
+    for (i = 0; i < SERVO_COUNT; i++)
+    {
+        uint8_t* setting = (uint8_t*) &servos[i] + field;
+
+        if (!servos[i].present)
+            continue;
+        if (*setting != SERVO_UNKNOWN && *setting == value)
+            continue;
+        ids[n] = i + 1;
+        values[n] = value;
+        n++;
+        *setting = value;
+    }
+    if (n > 0)
+        dxl_sync_write_bytes(address, ids, values, n);
+    return n;
+}
+
+/**
+ * Brings the bus settings of all servos to SERVO_STATUS_RETURN and
+ * SERVO_RETURN_DELAY, and sets the library's status packet timeout to the
+ * return delay. Until the delays are known, the reads wait as long as any
+ * servo can be set to delay. Call once the servos have powered up, before
+ * anything else uses the bus. Returns the number of servos that answered.
+ */
+uint8_t servoConfigure(void)
+{
+    uint8_t delay = 0;
+    uint8_t found = 0;
+    uint8_t i;
+
+    dxl_set_return_delay(SERVO_MAX_RETURN_DELAY * 2);
+    for (i = 0; i < SERVO_COUNT; i++)
+        readConfig(i + 1, &servos[i]);
+
+    if (writeChanged(P_RETURN_DELAY_TIME,
+                     offsetof(struct servoConfig, returnDelay),
+                     SERVO_RETURN_DELAY) > 0)
+        LOG(LOG_SERVO_CONFIG, P_RETURN_DELAY_TIME, SERVO_RETURN_DELAY);
+    if (writeChanged(P_STATUS_RETURN_LEVEL,
+                     offsetof(struct servoConfig, statusReturn),
+                     SERVO_STATUS_RETURN) > 0)
+        LOG(LOG_SERVO_CONFIG, P_STATUS_RETURN_LEVEL, SERVO_STATUS_RETURN);
+
+    for (i = 0; i < SERVO_COUNT; i++)
+    {
+        if (!servos[i].present)
+            continue;
+        found++;
+        dxl_set_status_return(i + 1, servos[i].statusReturn);
+        if (servos[i].returnDelay > delay)
+            delay = servos[i].returnDelay;
+    }
+    if (found > 0)
+        dxl_set_return_delay(delay * 2);
+    return found;
+}
+
+/**
+ * Returns the bus settings of servo 'id', as of servoConfigure, or 0 if
+ * there is no such servo.
+ */
+const struct servoConfig* servoConfigGet(uint8_t id)
+{
+    if (id < 1 || id > SERVO_COUNT)
+        return 0;
+    return &servos[id - 1];
+}
@@ -0,0 +1,50 @@
+/**
+ * Implements the start-up configuration of the servos' bus settings.
+ */
+
+#ifndef __SERVOCONFIG_H
+#define __SERVOCONFIG_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** SERVOS. */
+/* The servos have IDs 1 to SERVO_COUNT. */
+#define SERVO_COUNT             3
+
+/** CONTROL TABLE. */
+/* Both registers are in EEPROM, so they are only written when they differ
+   from what the servo already has. */
+#define P_RETURN_DELAY_TIME     5
+#define P_STATUS_RETURN_LEVEL   16
+
+/** BUS SETTINGS. */
+/* Goals go out in sync writes, which no servo answers, and telemetry reads
+   the servos, so only reads need a status packet. The return delay is in
+   units of 2 microseconds; it leaves the controller time to turn the bus
+   around after the instruction packet. */
+#define SERVO_STATUS_RETURN     STATUS_RETURN_READ
+#define SERVO_RETURN_DELAY      5
+#define SERVO_MAX_RETURN_DELAY  254     /* Longest a servo can be set to. */
+#define SERVO_UNKNOWN           0xFF    /* Register could not be read. */
+
+/**
+ * Represents the bus settings of one servo.
+ */
+struct servoConfig
+{
+    uint8_t present;        /* 1 if the servo answered. */
+    uint8_t statusReturn;   /* STATUS_RETURN_*, or SERVO_UNKNOWN. */
+    uint8_t returnDelay;    /* 2 microsecond units, or SERVO_UNKNOWN. */
+};
+
+/**
+ * Functions.
+ */
+uint8_t servoConfigure(void);
+const struct servoConfig* servoConfigGet(uint8_t id);
+
+#endif /* SERVOCONFIG_H */
@@ -0,0 +1,172 @@
+#include <util/atomic.h>
+#include <stdint.h>
+#include "dynamixel.h"
+#include "scheduler.h"
+#include "telemetry.h"
+
+/**
+ * Implements the sampling of servo state for the telemetry stream. The
+ * servo tick owns the Dynamixel bus, so it calls telemetryTick once its goals
+ * are written. The tick only queues the reads of a sample with the Dynamixel
+ * library's asynchronous engine and returns; the interrupt that ends the
+ * last read puts the sample together and hands it over to the main loop,
+ * which adds the forward kinematics and sends it.
+ */
+
+static volatile uint16_t rate = TELEMETRY_DEFAULT_HZ;
+static uint16_t countdown = 0;          /* Ticks until the next sample. */
+static struct dxl_bulk_entry entries[TELEMETRY_SERVOS];
+static uint8_t data[TELEMETRY_SERVOS][TELEMETRY_READ_LENGTH];
+#if TELEMETRY_BULK_READ
+static struct dxl_transaction reads[1];
+#else
+static struct dxl_transaction reads[TELEMETRY_SERVOS];
+#endif
+static volatile uint8_t pending = 0;    /* Reads of 'sample' not yet over. */
+static struct telemetry sample;         /* Sample being read. */
+static struct telemetry complete;       /* Last sample. */
+static volatile uint8_t available = 0;  /* 1 if 'complete' is not yet taken. */
+
+/**
+ * Stores the read of servo 'i' in 'sample'.
+ */
+static void storeRead(uint8_t i)
+{
+    if (entries[i].result != COMM_RXSUCCESS)
+    {
+        sample.errors |= 1 << i;
+        sample.ticks[i] = 0;
+        sample.load[i] = 0;
+        sample.temperature[i] = 0;
+        return;
+    }
+    sample.ticks[i] = data[i][TELEMETRY_POSITION] |
+                      data[i][TELEMETRY_POSITION + 1] << 8;
+    sample.load[i] = data[i][TELEMETRY_LOAD] |
+                     data[i][TELEMETRY_LOAD + 1] << 8;
+    sample.temperature[i] = data[i][TELEMETRY_TEMPERATURE];
+}
+
+/**
+ * Counts off the finished read 't', and once all are over, publishes the
+ * sample. Called with interrupts disabled.
+ */
+static void readDone(struct dxl_transaction* t)
+{
+    uint8_t i;
+
+#if TELEMETRY_BULK_READ
+    /* The library stored every reply in its entry. */
+    if (t->result == COMM_TXERROR || t->result == COMM_TXFAIL)
+        for (i = 0; i < TELEMETRY_SERVOS; i++)
+            entries[i].result = t->result;
+#else
+    struct dxl_bulk_entry* entry = &entries[t->id - 1];
+
+    entry->result = t->result;
+    if (t->result == COMM_RXSUCCESS)
+    {
+        if (t->num_param != TELEMETRY_READ_LENGTH)
+            entry->result = COMM_RXCORRUPT;
+        for (i = 0; i < TELEMETRY_READ_LENGTH; i++)
+            entry->data[i] = t->param[i];
+    }
+#endif
+    if (--pending > 0)
+        return;
+    sample.errors = 0;
+    for (i = 0; i < TELEMETRY_SERVOS; i++)
+        storeRead(i);
+    complete = sample;
+    available = 1;
+}
+
+/**
+ * Ends the read 't', which could not be queued.
+ */
+static void readFailed(struct dxl_transaction* t)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        t->result = COMM_TXFAIL;
+        readDone(t);
+    }
+}
+
+/**
+ * Sets the telemetry rate to 'hz' samples per second, 0 for none.
+ */
+void telemetrySetRate(uint16_t hz)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        rate = hz;
+        countdown = 0;
+    }
+}
+
+/**
+ * Queues the reads of a sample when one is due. Called from the servo tick.
+ * A sample still being read when the next is due makes that one skipped.
+ */
+void telemetryTick(void)
+{
+    uint8_t i;
+
+    if (rate == 0 || (countdown > 1 && --countdown > 0))
+        return;
+    if (pending > 0)
+        return;
+    countdown = (uint16_t) (1000000L / ((uint32_t) rate *
+                                        schedulerPeriod()));
+    if (countdown < 1)
+        countdown = 1;
+
+    sample.time = schedulerTime();
+    for (i = 0; i < TELEMETRY_SERVOS; i++)
+    {
+        entries[i].id = i + 1;
+        entries[i].address = TELEMETRY_READ_ADDRESS;
+        entries[i].length = TELEMETRY_READ_LENGTH;
+        entries[i].data = data[i];
+    }
+#if TELEMETRY_BULK_READ
+    pending = 1;
+    reads[0].done = readDone;
+    if (!dxl_async_bulk_read(&reads[0], entries, TELEMETRY_SERVOS))
+        readFailed(&reads[0]);
+#else
+    pending = TELEMETRY_SERVOS;
+    for (i = 0; i < TELEMETRY_SERVOS; i++)
+    {
+        struct dxl_transaction* t = &reads[i];
+
+        t->id = i + 1;
+        t->instruction = INST_READ;
+        t->param[0] = TELEMETRY_READ_ADDRESS;
+        t->param[1] = TELEMETRY_READ_LENGTH;
+        t->num_param = 2;
+        t->reply = TELEMETRY_READ_LENGTH;
+        t->bulk = 0;
+        t->done = readDone;
+        if (!dxl_async_submit(t))
+            readFailed(t);
+    }
+#endif
+}
+
+/**
+ * Copies the last sample into 'out'. Returns 0 if there is none since the
+ * last call.
+ */
+int telemetryGet(struct telemetry* out)
+{
+    if (!available)
+        return 0;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        *out = complete;
+        available = 0;
+    }
+    return 1;
+}
@@ -0,0 +1,53 @@
+/**
+ * Implements the sampling of servo state for the telemetry stream.
+ */
+
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** TELEMETRY SPECS. */
+/* A sample reads all servos in one bus transaction, queued after the goals
+   of the tick, so samples come at most at the tick rate. A rate of 0 turns
+   the stream off. TELEMETRY_BULK_READ 0 reads one servo at a time, for
+   servos without INST_BULK_READ; the goal write and those reads together
+   must fit in MAXNUM_ASYNC_QUEUE. */
+#define TELEMETRY_SERVOS        3
+#define TELEMETRY_DEFAULT_HZ    0
+#define TELEMETRY_BULK_READ     1
+
+/** CONTROL TABLE. */
+/* One read of TELEMETRY_READ_LENGTH bytes from P_PRESENT_POSITION_L covers
+   the present position, speed, load, voltage and temperature, at these
+   offsets. */
+#define TELEMETRY_READ_ADDRESS  36
+#define TELEMETRY_READ_LENGTH   8
+#define TELEMETRY_POSITION      0
+#define TELEMETRY_LOAD          4
+#define TELEMETRY_TEMPERATURE   7
+
+/**
+ * Represents one sample of the three servos.
+ */
+struct telemetry
+{
+    uint32_t time;          /* schedulerTime() at the start of the sample. */
+    uint16_t ticks[TELEMETRY_SERVOS];       /* Present position. */
+    uint16_t load[TELEMETRY_SERVOS];        /* Bit 10 is the direction. */
+    uint8_t temperature[TELEMETRY_SERVOS];  /* Degrees Celsius. */
+    uint8_t errors;         /* Bit i set if servo i + 1 did not answer. */
+};
+
+/**
+ * Functions.
+ */
+void telemetrySetRate(uint16_t hz);
+void telemetryTick(void);
+int telemetryGet(struct telemetry* out);
+
+#endif /* TELEMETRY_H */
@@ -0,0 +1,75 @@
+#include <stdint.h>
+#include "dynamixel.h"
+#include "serial.h"
+#include "protocol.h"
+#include "trace.h"
+
+/**
+ * Implements the event trace. Recording is inline in trace.h, so that it
+ * costs little enough to stay compiled in; this file starts the timestamp
+ * timer, forwards the Dynamixel library's events, and dumps the ring.
+ */
+
+struct traceEntry traceBuffer[TRACE_DEPTH];
+volatile uint8_t traceHead = 0;
+volatile uint8_t traceOn = 0;
+
+static uint8_t sequence = 0;            /* Counts CMD_TRACE frames sent. */
+
+/**
+ * Records a DXL_TRACE_ 'event' of the Dynamixel library.
+ */
+static void dxlEvent(int event)
+{
+    traceEvent(TRACE_DXL + event, 0);
+}
+
+/**
+ * Starts recording. The timestamps are timer 3, which dxl_hal_open already
+ * runs free at TRACE_TIMER_HZ for the bus timeouts, so dxl_initialize must
+ * come first.
+ */
+void traceStart(void)
+{
+    dxl_set_trace_hook(dxlEvent);
+    traceOn = 1;
+}
+
+/**
+ * Sends the ring to the host, oldest entry first, as CMD_TRACE frames of at
+ * most TRACE_PER_FRAME entries. Recording pauses meanwhile. Empties the ring
+ * if 'clear' is nonzero.
+ */
+void traceDump(uint8_t clear)
+{
+    struct frame f;
+    uint8_t out[FRAME_MAX_ENCODED + 2];
+    struct traceEntry* e;
+    uint8_t head;
+    uint8_t i;
+    uint8_t n;
+
+    traceOn = 0;
+    head = traceHead; /* The oldest entry, once the ring has wrapped. */
+    f.command = CMD_TRACE;
+    for (i = 0; i < TRACE_DEPTH; i += n)
+    {
+        f.sequence = sequence++;
+        f.payload[0] = i;
+        f.payload[1] = TRACE_DEPTH;
+        f.length = 2;
+        for (n = 0; n < TRACE_PER_FRAME && i + n < TRACE_DEPTH; n++)
+        {
+            e = &traceBuffer[(head + i + n) & (TRACE_DEPTH - 1)];
+            f.payload[f.length++] = e->event;
+            f.payload[f.length++] = e->arg;
+            framePutInt16(&f, f.length, e->time);
+            f.length += 2;
+        }
+        serial_write(out, frameEncode(&f, out));
+    }
+    if (clear)
+        for (i = 0; i < TRACE_DEPTH; i++)
+            traceBuffer[i].event = TRACE_NONE;
+    traceOn = 1;
+}
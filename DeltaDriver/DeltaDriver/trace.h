@@ -0,0 +1,76 @@
+/**
+ * Implements the event trace: a ring of timestamped events in SRAM, dumped
+ * to the host on request.
+ */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stdint.h>
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** TRACE SPECS. */
+/* Timestamps are timer 3 counts, free-running at TRACE_TIMER_HZ, so they
+   wrap every 32.8 ms; the host only takes differences of close events.
+   TRACE_DEPTH must be a power of two. */
+#define TRACE_DEPTH         64
+#define TRACE_TIMER_HZ      2000000L
+#define TRACE_PER_FRAME     15    /* Entries per CMD_TRACE frame. */
+
+/** EVENTS. */
+#define TRACE_NONE          0     /* Unused entry. */
+#define TRACE_BYTE          1     /* Host byte read; arg is the byte. */
+#define TRACE_FRAME         2     /* Frame parsed; arg is its command. */
+#define TRACE_TICK_START    3
+#define TRACE_TICK_END      4
+#define TRACE_IK_START      5     /* lookupAngles. */
+#define TRACE_IK_END        6
+#define TRACE_DXL           7     /* Plus a DXL_TRACE_ event: TX start and
+                                     end, RX start and end, RX timeout. */
+
+/**
+ * Represents one event.
+ */
+struct traceEntry
+{
+    uint8_t event;
+    uint8_t arg;
+    uint16_t time;          /* Timer 3 counts. */
+};
+
+extern struct traceEntry traceBuffer[TRACE_DEPTH];
+extern volatile uint8_t traceHead;      /* Next entry to write. */
+extern volatile uint8_t traceOn;        /* 0 while the ring is dumped. */
+
+/**
+ * Records 'event' with 'arg'. Safe from interrupts, and about 20 cycles.
+ */
+static inline void traceEvent(uint8_t event, uint8_t arg)
+{
+    struct traceEntry* e;
+    uint8_t sreg = SREG;
+
+    cli();
+    if (traceOn)
+    {
+        e = &traceBuffer[traceHead];
+        traceHead = (traceHead + 1) & (TRACE_DEPTH - 1);
+        e->event = event;
+        e->arg = arg;
+        e->time = TCNT3;
+    }
+    SREG = sreg;
+}
+
+/**
+ * Functions.
+ */
+void traceStart(void);
+void traceDump(uint8_t clear);
+
+#endif /* TRACE_H */
@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "workspace.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#define SDF_READ(entry) ((int16_t) pgm_read_word(&(entry)))
+#else
+#define PROGMEM
+#define SDF_READ(entry) (entry)
+#endif
+
+#include "sdf_table.h"
+
+#define TESTING 0 /* Determines whether certain parts will be compiled. */
+
+/**
+ * Implements the signed-distance field of the pen workspace of a delta robot.
+ * The pen workspace is the union of the cylinder above the clamps and the
+ * rectangular prism above the paper. Distances are positive outside the
+ * workspace and negative inside it.
+ */
+
+/**
+ * Returns the signed distance from 'p' to a cylinder of radius 'r' about the
+ * z-axis from 'zLow' to 'zHigh'.
+ */
+static double cylinderDistance(struct point p, double r, double zLow,
+                               double zHigh)
+{
+    double dr = sqrt(p.x * p.x + p.y * p.y) - r;
+    double dz = fmax(zLow - p.z, p.z - zHigh);
+    return hypot(fmax(dr, 0), fmax(dz, 0)) + fmin(fmax(dr, dz), 0);
+}
+
+/**
+ * Returns the signed distance from 'p' to the box with half-widths 'xHalf' and
+ * 'yHalf' about the z-axis, from 'zLow' to 'zHigh'.
+ */
+static double boxDistance(struct point p, double xHalf, double yHalf,
+                          double zLow, double zHigh)
+{
+    double dx = fabs(p.x) - xHalf;
+    double dy = fabs(p.y) - yHalf;
+    double dz = fmax(zLow - p.z, p.z - zHigh);
+    double outside = sqrt(pow(fmax(dx, 0), 2) + pow(fmax(dy, 0), 2) +
+                          pow(fmax(dz, 0), 2));
+    return outside + fmin(fmax(dx, fmax(dy, dz)), 0);
+}
+
+/**
+ * Returns the exact signed distance from the endpoint 'p' to the boundary of
+ * the pen workspace, in inches. Used to generate the table; too slow to call
+ * at the control rate.
+ */
+double workspaceDistance(struct point p)
+{
+    double dCylinder = cylinderDistance(p, WS_R_MAX, Z_PEN_CLAMP, WS_Z_MAX);
+    double dPrism = boxDistance(p, X_RCT_MAX, Y_RCT_MAX,
+                                fmax(Z_PEN_PAPER, WS_Z_MIN), Z_PEN_CLAMP);
+    return fmin(dCylinder, dPrism);
+}
+
+/**
+ * Returns the signed distance from 'p' to the pen workspace by trilinear
+ * interpolation of SDF_TABLE, and stores its gradient in 'gradient' (length 3).
+ * Points outside the table are evaluated at the nearest table point.
+ */
+double sdfLookup(struct point p, double* gradient)
+{
+    /* Fold into the first quadrant and clamp to the table. */
+    double x = fmin(fabs(p.x), SDF_XY_MAX);
+    double y = fmin(fabs(p.y), SDF_XY_MAX);
+    double z = fmin(fmax(p.z, SDF_Z_MIN), SDF_Z_MAX);
+
+    int xInd = (int) (x / SDF_RES);
+    int yInd = (int) (y / SDF_RES);
+    int zInd = (int) ((z - SDF_Z_MIN) / SDF_RES);
+    if (xInd > SDF_XY_DIM - 2)
+        xInd = SDF_XY_DIM - 2;
+    if (yInd > SDF_XY_DIM - 2)
+        yInd = SDF_XY_DIM - 2;
+    if (zInd > SDF_Z_DIM - 2)
+        zInd = SDF_Z_DIM - 2;
+
+    double xProp = x / SDF_RES - xInd;
+    double yProp = y / SDF_RES - yInd;
+    double zProp = (z - SDF_Z_MIN) / SDF_RES - zInd;
+
+    /* 'cijk' is the corner (xInd + i, yInd + j, zInd + k). */
+    double c000 = SDF_READ(SDF_TABLE[xInd][yInd][zInd]);
+    double c001 = SDF_READ(SDF_TABLE[xInd][yInd][zInd + 1]);
+    double c010 = SDF_READ(SDF_TABLE[xInd][yInd + 1][zInd]);
+    double c011 = SDF_READ(SDF_TABLE[xInd][yInd + 1][zInd + 1]);
+    double c100 = SDF_READ(SDF_TABLE[xInd + 1][yInd][zInd]);
+    double c101 = SDF_READ(SDF_TABLE[xInd + 1][yInd][zInd + 1]);
+    double c110 = SDF_READ(SDF_TABLE[xInd + 1][yInd + 1][zInd]);
+    double c111 = SDF_READ(SDF_TABLE[xInd + 1][yInd + 1][zInd + 1]);
+
+    /* Collapse the x-axis, then y, then z. */
+    double c00 = c000 + xProp * (c100 - c000);
+    double c01 = c001 + xProp * (c101 - c001);
+    double c10 = c010 + xProp * (c110 - c010);
+    double c11 = c011 + xProp * (c111 - c011);
+    double c0 = c00 + yProp * (c10 - c00);
+    double c1 = c01 + yProp * (c11 - c01);
+
+    /* Gradient of the interpolant, in inches per inch. */
+    double scale = SDF_SCALE * SDF_RES;
+    gradient[0] = ((1 - zProp) * ((1 - yProp) * (c100 - c000) +
+                                  yProp * (c110 - c010)) +
+                   zProp * ((1 - yProp) * (c101 - c001) +
+                            yProp * (c111 - c011))) / scale;
+    gradient[1] = ((1 - zProp) * (c10 - c00) + zProp * (c11 - c01)) / scale;
+    gradient[2] = (c1 - c0) / scale;
+    if (p.x < 0)
+        gradient[0] = -gradient[0];
+    if (p.y < 0)
+        gradient[1] = -gradient[1];
+
+    return (c0 + zProp * (c1 - c0)) / SDF_SCALE;
+}
+
+/**
+ * Returns the point of the pen workspace closest to 'p'. Points inside the
+ * workspace are returned unchanged; points outside are moved down the gradient
+ * of the signed-distance field by their distance to the boundary, then clamped
+ * exactly onto the faces, so the result always passes penPointValid.
+ */
+struct point projectToWorkspace(struct point p)
+{
+    double gradient[3];
+    double r;
+    int step;
+
+    /* Start from the nearest point of the table. */
+    p.x = fmin(fmax(p.x, -SDF_XY_MAX), SDF_XY_MAX);
+    p.y = fmin(fmax(p.y, -SDF_XY_MAX), SDF_XY_MAX);
+    p.z = fmin(fmax(p.z, SDF_Z_MIN), SDF_Z_MAX);
+
+    for (step = 0; step < SDF_MAX_STEPS; step++)
+    {
+        double d = sdfLookup(p, gradient);
+        double n = sqrt(gradient[0] * gradient[0] +
+                        gradient[1] * gradient[1] +
+                        gradient[2] * gradient[2]);
+        if (d <= SDF_TOLERANCE || n < 0.001)
+            break;
+        d = (d + SDF_MARGIN) / n;
+        p.x -= d * gradient[0];
+        p.y -= d * gradient[1];
+        p.z -= d * gradient[2];
+    }
+
+    /* The interpolated field stops up to SDF_TOLERANCE outside, and near the
+       concave edge where the prism meets the bottom of the cylinder its
+       gradient is a blend of the two faces. Points left below the clamps
+       outside the paper finish on the bottom of the cylinder; the rest are
+       clamped onto the nearest face. */
+    p.z = fmin(p.z, WS_Z_MAX);
+    if (p.z < Z_PEN_CLAMP)
+    {
+        if (fabs(p.x) > X_RCT_MAX || fabs(p.y) > Y_RCT_MAX)
+            p.z = Z_PEN_CLAMP;
+        else
+            p.z = fmax(p.z, fmax(Z_PEN_PAPER, WS_Z_MIN));
+    }
+    if (p.x * p.x + p.y * p.y > WS_R_MAX * WS_R_MAX)
+    {
+        r = sqrt(p.x * p.x + p.y * p.y);
+        p.x *= (WS_R_MAX - SDF_MARGIN) / r;
+        p.y *= (WS_R_MAX - SDF_MARGIN) / r;
+    }
+    return p;
+}
+
+/**
+ * Returns 1 if the endpoint 'p' keeps the pen within the pen workspace; 0
+ * otherwise.
+ */
+int penPointValid(struct point p)
+{
+    if (p.x * p.x + p.y * p.y > WS_R_MAX * WS_R_MAX || p.z > WS_Z_MAX)
+        return 0;
+    if (p.z >= Z_PEN_CLAMP)
+        return 1;
+    return fabs(p.x) <= X_RCT_MAX && fabs(p.y) <= Y_RCT_MAX &&
+           p.z >= Z_PEN_PAPER && p.z >= WS_Z_MIN;
+}
+
+/**
+ * Writes SDF_TABLE, sampled from workspaceDistance, in a format that enables
+ * its initialization in the C programming language. File name is
+ * 'sdf_table.h'.
+ */
+#if TESTING
+void writeSdfTable(void)
+{
+    FILE *f = fopen("sdf_table.h", "w");
+    if (f == NULL)
+    {
+        printf("Error opening file!\n");
+        exit(1);
+    }
+
+    struct point p;
+    int xIndex;
+    int yIndex;
+    int zIndex;
+
+    fprintf(f, "/**\n * Signed-distance field of the pen workspace, in "
+               "thousandths of an inch.\n * Generated by writeSdfTable() in "
+               "workspace.c -- do not edit.\n */\n\n");
+    fprintf(f, "static const int16_t SDF_TABLE[%d][%d][%d] PROGMEM =\n{\n",
+            SDF_XY_DIM, SDF_XY_DIM, SDF_Z_DIM);
+    for (xIndex = 0; xIndex < SDF_XY_DIM; xIndex++)
+    {
+        fprintf(f, "    {\n");
+        for (yIndex = 0; yIndex < SDF_XY_DIM; yIndex++)
+        {
+            fprintf(f, "        {");
+            for (zIndex = 0; zIndex < SDF_Z_DIM; zIndex++)
+            {
+                p.x = SDF_RES * xIndex;
+                p.y = SDF_RES * yIndex;
+                p.z = SDF_Z_MIN + SDF_RES * zIndex;
+                fprintf(f, "%d", (int) lround(workspaceDistance(p) *
+                                              SDF_SCALE));
+                /* Add a comma unless this is the last entry. */
+                if (zIndex != SDF_Z_DIM - 1)
+                    fprintf(f, ",");
+            }
+            fprintf(f, "}");
+            if (yIndex != SDF_XY_DIM - 1)
+                fprintf(f, ",");
+            fprintf(f, "\n");
+        }
+        fprintf(f, "    }");
+        if (xIndex != SDF_XY_DIM - 1)
+            fprintf(f, ",");
+        fprintf(f, "\n");
+    }
+    fprintf(f, "};\n");
+
+    fclose(f);
+}
+
+/**
+ * Regenerates the table and checks the projection against the exact field.
+ */
+int main(void)
+{
+    writeSdfTable();
+
+    struct point p;
+    struct point q;
+    double worst = 0;
+    int invalid = 0;
+    for (p.x = -8; p.x <= 8; p.x += 0.37)
+        for (p.y = -8; p.y <= 8; p.y += 0.41)
+            for (p.z = -15; p.z <= -6; p.z += 0.29)
+            {
+                q = projectToWorkspace(p);
+                worst = fmax(worst, workspaceDistance(q));
+                invalid += !penPointValid(q);
+            }
+    printf("Worst distance outside after projection: %.4f\n", worst);
+    printf("Projections failing penPointValid: %d\n", invalid);
+    return 0;
+}
+#endif
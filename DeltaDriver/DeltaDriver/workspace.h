@@ -0,0 +1,59 @@
+/**
+ * Implements the signed-distance field of the pen workspace of a delta robot.
+ */
+
+#ifndef __WORKSPACE_H
+#define __WORKSPACE_H
+
+#include <stdint.h>
+#include "functions.h"
+
+/**
+ * GLOBAL CONSTANTS
+ */
+
+/** PEN WORKSPACE. */
+/* Mirrors Python/workspace.py. The endpoint lives in a cylinder of radius
+   WS_R_MAX from WS_Z_MIN to WS_Z_MAX. The pen (PEN_DIST below the endpoint)
+   must stay above Z_CLAMP, except inside the paper rectangle, where it may go
+   down to Z_PAPER. These are the host values, 0.01 inside the limits in
+   functions.h, so a projected point always passes pointValid. */
+#define WS_R_MAX      6.00    /* Max radius of cylinder in inches. */
+#define WS_Z_MIN    -13.00    /* Lowest height of cylinder in inches. */
+#define WS_Z_MAX     -8.00    /* Maximum height of cylinder in inches. */
+#define X_RCT_MAX     4.50    /* x-max of rectangle for the paper (symmetric). */
+#define Y_RCT_MAX     3.75    /* y-max of rectangle for the paper (symmetric). */
+#define Z_PAPER     -14.50    /* Z location of the paper. */
+#define Z_CLAMP     -13.50    /* Z location of the clamps. */
+#define PEN_DIST      2.00    /* Protrusion of pen below the bottom triangle. */
+
+/* Endpoint heights at which the pen touches the clamps / the paper. */
+#define Z_PEN_CLAMP  (Z_CLAMP + PEN_DIST)
+#define Z_PEN_PAPER  (Z_PAPER + PEN_DIST)
+
+/** SIGNED DISTANCE FIELD SPECS. */
+/* The workspace is symmetric in x and y, so the table only covers the
+   quadrant x >= 0, y >= 0. Includes a 0.5" border around the boundary. */
+#define SDF_XY_MAX    6.50    /* Maximum |x| and |y| in the table. */
+#define SDF_Z_MIN   -13.00    /* Minimum z-value in the table. */
+#define SDF_Z_MAX    -7.50    /* Maximum z-value in the table. */
+#define SDF_RES       0.25    /* Resolution of the table on every axis. */
+#define SDF_SCALE  1000.0     /* Table entries are in thousandths of an inch. */
+
+#define SDF_XY_DIM   (int) (SDF_XY_MAX / SDF_RES + 1)
+#define SDF_Z_DIM    (int) ((SDF_Z_MAX - SDF_Z_MIN) / SDF_RES + 1)
+
+#define SDF_TOLERANCE 0.002   /* Distance counted as on the boundary. */
+#define SDF_MARGIN    0.001   /* Extra step into the workspace. */
+#define SDF_MAX_STEPS 3       /* Gradient steps per projection. */
+
+/**
+ * Functions.
+ */
+double workspaceDistance(struct point p);
+double sdfLookup(struct point p, double* gradient);
+struct point projectToWorkspace(struct point p);
+int penPointValid(struct point p);
+void writeSdfTable(void);
+
+#endif /* WORKSPACE_H */
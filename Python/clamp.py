@@ -0,0 +1,146 @@
+import workspace
+from math import sqrt
+import os
+import ctypes
+
+#
+# Binds the native workspace clamping library built from
+# DeltaDriver/DeltaDriver/clamp.c ('make' in this directory). Whole arrays of
+# points are clamped in one call. If the library or numpy is missing, the
+# pure-Python implementations are used instead and 'available' is False.
+#
+
+if os.name == "nt":
+    LIB_NAME = "deltaclamp.dll"
+else:
+    LIB_NAME = "libdeltaclamp.so"
+
+class Point(ctypes.Structure):
+    """
+    Mirrors 'struct point' in functions.h.
+    """
+    _fields_ = [("x", ctypes.c_double),
+                ("y", ctypes.c_double),
+                ("z", ctypes.c_double)]
+
+try:
+    import numpy
+    _lib = ctypes.CDLL(os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                    LIB_NAME))
+    _doubles = numpy.ctypeslib.ndpointer(dtype = numpy.float64, ndim = 2,
+                                         flags = "C_CONTIGUOUS")
+    _lib.boundDestination.argtypes = [Point, Point]
+    _lib.boundDestination.restype = Point
+    _lib.restrainMove.argtypes = [Point, Point, ctypes.c_double,
+                                  ctypes.c_double]
+    _lib.restrainMove.restype = Point
+    _lib.boundPoints.argtypes = [_doubles, _doubles, _doubles, ctypes.c_int]
+    _lib.boundPoints.restype = None
+    _lib.clampPath.argtypes = [_doubles, _doubles, ctypes.c_int, _doubles,
+                               ctypes.c_double, ctypes.c_double]
+    _lib.clampPath.restype = None
+    _lib.checkSegments.argtypes = [_doubles, ctypes.c_int,
+                                   numpy.ctypeslib.ndpointer(numpy.uint8)]
+    _lib.checkSegments.restype = None
+    _lib.splitPath.argtypes = [_doubles, ctypes.c_int, _doubles]
+    _lib.splitPath.restype = ctypes.c_int
+    available = True
+except (ImportError, OSError):
+    available = False
+
+def _pointArray(points):
+    """
+    Returns 'points' (a list of (x, y, z) tuples or an array) as a
+    C-contiguous float64 numpy array of shape (n, 3).
+    """
+    return numpy.ascontiguousarray(points, dtype = numpy.float64).reshape(-1, 3)
+
+def boundDestination(pStart, pEnd):
+    """
+    Same as workspace.boundDestination, in native code.
+    """
+    if not available:
+        return workspace.boundDestination(pStart, pEnd)
+    p = _lib.boundDestination(Point(*pStart), Point(*pEnd))
+    return (p.x, p.y, p.z)
+
+def restrainMove(pStart, pEnd, restrainThresh, restrainDist):
+    """
+    Returns 'pEnd' if it is within 'restrainThresh' of 'pStart'. Otherwise,
+    returns the point 'restrainDist' from 'pStart' in the direction of 'pEnd'.
+    """
+    if available:
+        p = _lib.restrainMove(Point(*pStart), Point(*pEnd),
+                              restrainThresh, restrainDist)
+        return (p.x, p.y, p.z)
+    (dx, dy, dz) = (pEnd[0] - pStart[0], pEnd[1] - pStart[1],
+                    pEnd[2] - pStart[2])
+    dist = sqrt(dx ** 2 + dy ** 2 + dz ** 2)
+    if dist <= restrainThresh:
+        return pEnd
+    return (pStart[0] + restrainDist * dx / dist,
+            pStart[1] + restrainDist * dy / dist,
+            pStart[2] + restrainDist * dz / dist)
+
+def boundPoints(starts, ends):
+    """
+    Bounds each point of 'ends' with boundDestination, moving from the
+    matching point of 'starts'. Returns an (n, 3) array, or a list of tuples if
+    the native library is not available.
+    """
+    if not available:
+        return [workspace.boundDestination(s, e) for (s, e) in zip(starts, ends)]
+    starts = _pointArray(starts)
+    ends = _pointArray(ends)
+    if len(starts) != len(ends):
+        raise ValueError("'starts' and 'ends' must have the same length.")
+    out = numpy.empty_like(ends)
+    _lib.boundPoints(starts, ends, out, len(ends))
+    return out
+
+def clampPath(path, start, restrainThresh, restrainDist):
+    """
+    Clamps the desired positions in 'path' the way the tracking loop does: each
+    one is bounded and restrained from the previous output, starting from the
+    point 'start'. Returns an (n, 3) array, or a list of tuples if the native
+    library is not available.
+    """
+    if not available:
+        out = []
+        current = start
+        for p in path:
+            current = restrainMove(current,
+                                   workspace.boundDestination(current, p),
+                                   restrainThresh, restrainDist)
+            out.append(current)
+        return out
+    path = _pointArray(path)
+    out = numpy.empty_like(path)
+    _lib.clampPath(path, out, len(path), _pointArray(start),
+                   restrainThresh, restrainDist)
+    return out
+
+def checkSegments(path):
+    """
+    Returns, for each move between consecutive points of 'path', whether the
+    pen stays within the workspace along the whole move.
+    """
+    if not available:
+        return [workspace.penPointValid(a) and workspace.penPointValid(b) and
+                workspace.segmentValid(a, b) for (a, b) in zip(path, path[1:])]
+    path = _pointArray(path)
+    valid = numpy.zeros(max(len(path) - 1, 0), dtype = numpy.uint8)
+    _lib.checkSegments(path, len(path), valid)
+    return valid.astype(bool)
+
+def splitPath(path):
+    """
+    Same as workspace.splitPath, in native code. Returns an (n, 3) array, or a 
+    list of tuples if the native library is not available.
+    """
+    if not available:
+        return workspace.splitPath(path)
+    path = _pointArray(path)
+    out = numpy.empty((3 * len(path), 3))
+    count = _lib.splitPath(path, len(path), out)
+    return out[:count]
@@ -1,9 +1,13 @@
 from workspace import *
 from math import *
 import time
+import struct
 import threading
 import serial
 import Leap
+import clamp
+import protocol
+import logdecode
 
 #
 # Processes input from the Leap Motion and uses it to send data to a Delta
@@ -23,7 +27,18 @@ numAvgs = 25 #Best 25 # number of times to average average hand pos
 
 restrainThresh = 0.15 # inches  # Best: 0.15
 restrainDist   = 0.15 # inches  # Best: 0.15
-sleepTime      = 0.001 # seconds # Best: 0.001
+sleepTime      = 0.001 # seconds # Best: 0.001 (ASCII only)
+useBinary      = True  # Send binary frames instead of ASCII '$x,y,z*y'.
+creditTimeout  = 0.1   # seconds to wait for a credit before asking again.
+servoRate      = 100   # Hz, rate at which the robot moves through setpoints.
+pointTime      = 10    # ms the robot spends on each point of a playback.
+lineFeed       = 2.0   # inches per second of lines drawn by the robot.
+maxVelocity    = 5.0   # inches per second, limit of the robot's profiler.
+maxAccel       = 20.0  # inches per second squared, likewise.
+profile        = protocol.PROFILE_SCURVE
+telemetryRate  = 20    # Hz, samples of the servos' actual state; 0 for none.
+telemetryLog   = None  # File to log the samples to as CSV, or None.
+linkBaud       = 1000000 # Baud rate to switch the link to after connecting.
 
 xOffset = 0.0
 yOffset = 0.0
@@ -187,6 +202,8 @@ def sclProd(s, v):
 
 def lineImg(p1, p2, step):
     """
+    OBSOLETE -- Use ControllerThread.outputLine instead, which has the robot
+    interpolate the line itself.
     Returns a list of tuples representing the points from 'p1' to 'p2',
     incrementing by size 'step'.
     """
@@ -198,6 +215,22 @@ def lineImg(p1, p2, step):
         currentPos = add(currentPos, sclProd(step, direction))
     img.append(p2)
     return img
+
+def subdividePath(path, step):
+    """
+    Returns the list 'path' of points (x, y, z) with evenly spaced points added
+    along every straight move longer than 'step', so that no move is longer 
+    than 'step'.
+    """
+    out = [tuple(path[0])]
+    for p in path[1:]:
+        p = tuple(p)
+        start = out[-1]
+        steps = max(1, int(ceil(dist(start, p) / step)))
+        for i in range(1, steps):
+            out.append(add(start, sclProd(float(i) / steps, dirTo(start, p))))
+        out.append(p)
+    return out
     
                      
 class ControllerThread(threading.Thread):
@@ -220,15 +253,39 @@ class ControllerThread(threading.Thread):
         
         # Current estimated position of robot. 
         self.currentPos = HOME # Starts by default at home upon powerup.
+        self.sequence = 0      # Sequence number of the next binary frame.
+        self.credits = 0       # Setpoints the robot has room for.
+        self.lastCredit = 0    # time.time() of the last CMD_CREDIT frame.
+        self.inFlight = []     # (sequence, setpoints, bytes) of unacknowledged
+                               # frames.
+        self.stats = None      # Last CMD_STATS reply, as a dictionary.
+        self.baudReply = None  # Rate of the last CMD_BAUD reply.
+        self.telemetry = None  # Last CMD_TELEMETRY sample, as a dictionary.
+        self.measuredPos = None # Position the robot reported, if known.
+        self.log = open(telemetryLog, "w") if telemetryLog else None
+        if self.log:
+            self.log.write("time,t1,t2,t3,load1,load2,load3,temp1,temp2,"
+                           "temp3,x,y,z,queued,errors\n")
+        self.showStats = False # indicates controller should print stats
+        self.reader = protocol.FrameReader()
+        self.logDecoder = logdecode.LogDecoder()
         
         # Serial object.
         self.ser = serial.Serial()
-        self.ser.baudrate = 57600
+        self.ser.baudrate = protocol.DEFAULT_BAUD
         self.ser.port = 4 # = COM port - 1
+        self.ser.timeout = creditTimeout
         try: 
             self.ser.open()
             time.sleep(0.1) # Wait for serial to open
             self.serConnected = True
+            if useBinary:
+                self.negotiateBaud(linkBaud)
+                self.sendFrame(protocol.rateFrame(self.sequence, servoRate))
+                self.sendFrame(protocol.limitsFrame(self.sequence, maxVelocity,
+                                                    maxAccel, profile))
+                self.sendFrame(protocol.telemetryRateFrame(self.sequence,
+                                                           telemetryRate))
         except Exception as e:
             print "COULD NOT CONNECT OVER SERIAL."
             return
@@ -242,20 +299,41 @@ class ControllerThread(threading.Thread):
     def outputImage(self, img):
         """
         Outputs the image 'img', which consists of a list of tuples of the form
-        (x, y, z).
+        (x, y, z). The points were bounded as they were recorded; the whole
+        image, starting from the current position, is checked in one call, and
+        moves that would cut through the clamps are split into a rise, a 
+        crossing and a drop. Every move is then cut into steps of at most
+        'restrainDist', so the robot follows the split exactly.
         """
-        for p in img:
-            self.outputPosition(p)
-            if self.stop:
-                return
+        img = clamp.splitPath([self.currentPos] + [tuple(p) for p in img])
+        img = subdividePath(img, restrainDist)[1:]
+        if useBinary:
+            # Batched: the robot queues each frame of points all at once.
+            for i in range(0, len(img), protocol.WAYPOINTS_MAX):
+                points = [tuple(p) for p in img[i:i + protocol.WAYPOINTS_MAX]]
+                if not self.outputWaypoints(points):
+                    return
+                self.currentPos = points[-1]
+        else:
+            for p in img:
+                self.outputPosition(p)
+                self.currentPos = tuple(p)
+                if self.stop:
+                    return
         self.outputPosition(HOME)
-        print("'p' to playback - Enter to cancel")
+        self.currentPos = HOME
+        print("'p' to playback, 's' for stats - Enter to cancel")
             
             
     def outputPosition(self, p):
         """
         Outputs the position 'p' = (x, y, z) over the serial.
         """
+        if useBinary:
+            if not self.waitForCredit():
+                return
+            self.sendFrame(protocol.positionFrame(self.sequence, p), 1)
+            return
         # First, generate the string to be outputted. 
         (x, y, z) = p
         output = ("$" +
@@ -270,9 +348,270 @@ class ControllerThread(threading.Thread):
         self.ser.write(output)
         time.sleep(sleepTime)
         
+    def outputLivePosition(self, p):
+        """
+        Outputs the live position 'p' = (x, y, z) only once the robot has
+        taken every setpoint sent before, and returns True if it was sent.
+        Queueing live positions behind each other would add a tick of latency
+        per setpoint; instead 'p' is dropped, and a newer one takes its place.
+        The robot sends a credit as soon as its queue runs empty.
+        """
+        if not useBinary:
+            self.outputPosition(p)
+            return True
+        if self.ser.inWaiting():
+            self.readCredits()
+        if self.credits < protocol.QUEUE_CAPACITY:
+            if time.time() - self.lastCredit > creditTimeout:
+                self.sendFrame(protocol.creditRequestFrame(self.sequence))
+                self.lastCredit = time.time()
+            return False
+        self.sendFrame(protocol.positionFrame(self.sequence, p), 1)
+        return True
+
+    def outputLine(self, p, feed = lineFeed):
+        """
+        Has the robot move in a straight line from its current position to
+        'p' = (x, y, z), at 'feed' inches per second. The robot interpolates
+        the line at its tick rate, so this is a single frame.
+        """
+        if not useBinary: # Fall back to close points, 'restrainDist' apart.
+            start = self.currentPos
+            steps = max(1, int(ceil(dist(start, p) / restrainDist)))
+            for i in range(1, steps + 1):
+                self.outputPosition(add(start, sclProd(float(i) / steps,
+                                                       dirTo(start, p))))
+            self.currentPos = p
+            return
+        if not self.waitForCredit():
+            return
+        self.sendFrame(protocol.lineFrame(self.sequence, p, feed), 1)
+        self.currentPos = p
+
+    def outputPolyline(self, points, feed = lineFeed):
+        """
+        Has the robot move through 'points' in straight lines at 'feed'
+        inches per second. The robot plans the corners ahead, so it only
+        slows down as much as each corner needs instead of stopping at every
+        point, as long as the lines are sent faster than they are drawn.
+        """
+        for p in points:
+            self.outputLine(p, feed)
+
+    def outputBezier(self, p1, p2, p3, duration):
+        """
+        Has the robot follow the cubic Bezier curve from its current position
+        with control points 'p1' and 'p2' to 'p3', taking 'duration' seconds.
+        The robot evaluates the curve itself, so this is a single frame. Each
+        sample is projected onto the workspace, so a curve that leaves it is
+        flattened against the boundary.
+        """
+        if not useBinary: # Fall back to points 'pointTime' apart.
+            p0 = self.currentPos
+            steps = max(1, int(round(duration * 1000.0 / pointTime)))
+            for i in range(1, steps + 1):
+                t = float(i) / steps
+                u = 1 - t
+                self.outputPosition(tuple(u ** 3 * p0[k] +
+                                          3 * u * u * t * p1[k] +
+                                          3 * u * t * t * p2[k] +
+                                          t ** 3 * p3[k] for k in range(3)))
+            self.currentPos = p3
+            return
+        if not self.waitForCredit(3): # Two control points and the curve.
+            return
+        self.sendFrame(protocol.bezierFrame(self.sequence, p1, p2, p3,
+                                            duration * 1000), 3)
+        self.currentPos = p3
+
+    def outputArc(self, centre, p, ccw, feed = lineFeed):
+        """
+        Has the robot move on an arc in the XY-plane from its current position,
+        about 'centre' = (x, y), to 'p' = (x, y, z), counter-clockwise if
+        'ccw', at 'feed' inches per second. Ending where it starts draws a
+        full circle. The robot interpolates the arc itself, so this is a
+        single frame.
+        """
+        if not useBinary: # Fall back to close points, 'restrainDist' apart.
+            p0 = self.currentPos
+            a0 = atan2(p0[y] - centre[y], p0[x] - centre[x])
+            sweep = atan2(p[y] - centre[y], p[x] - centre[x]) - a0
+            if ccw and sweep <= 1e-6:
+                sweep += 2 * pi
+            elif not ccw and sweep >= -1e-6:
+                sweep -= 2 * pi
+            r = hypot(p0[x] - centre[x], p0[y] - centre[y])
+            steps = max(1, int(ceil(abs(sweep) * r / restrainDist)))
+            for i in range(1, steps + 1):
+                a = a0 + sweep * i / steps
+                self.outputPosition((centre[x] + r * cos(a),
+                                     centre[y] + r * sin(a),
+                                     p0[z] + (p[z] - p0[z]) * i / steps))
+            self.currentPos = p
+            return
+        if not self.waitForCredit(2): # The centre and the arc.
+            return
+        self.sendFrame(protocol.arcFrame(self.sequence, centre, p, feed, ccw),
+                       2)
+        self.currentPos = p
+
+    def outputWaypoints(self, points):
+        """
+        Outputs the list 'points' of (x, y, z), at most WAYPOINTS_MAX, in one
+        frame, spending 'pointTime' on each. Returns False if the thread was
+        stopped while waiting for room.
+        """
+        if not self.waitForCredit(len(points)):
+            return False
+        self.sendFrame(protocol.waypointsFrame(self.sequence, points,
+                                               [pointTime] * len(points)),
+                       len(points))
+        return True
+
+    def sendFrame(self, frame, setpoints = 0):
+        """
+        Writes the binary 'frame', built with the current sequence number,
+        which takes 'setpoints' slots of the robot's queue. Waits until the
+        frame fits in the robot's receive buffer first.
+        """
+        self.waitForRoom(len(frame))
+        self.ser.write(frame)
+        self.inFlight.append((self.sequence, setpoints, len(frame)))
+        self.credits -= setpoints
+        self.sequence = (self.sequence + 1) & 0xFF
+
+    def waitForRoom(self, size):
+        """
+        Blocks until 'size' more bytes fit in the robot's serial receive
+        buffer, next to the frames it has not acknowledged. The robot answers
+        every frame it reads, so this bounds the bytes waiting for it, however
+        long its tick holds up the main loop. If no answer comes within
+        'creditTimeout', the frames were lost and the buffer is empty.
+        """
+        deadline = time.time() + creditTimeout
+        while (sum(b for (s, n, b) in self.inFlight) + size >
+               protocol.RX_BUFFER):
+            if time.time() > deadline:
+                self.inFlight = [(s, n, 0) for (s, n, b) in self.inFlight
+                                 if n > 0]
+                return
+            self.readCredits()
+
+    def negotiateBaud(self, baud):
+        """
+        Switches the link to 'baud', if the robot accepts it, and checks that
+        frames get through at the new rate. Otherwise both ends stay at, or
+        go back to, the current rate. Returns True if the link runs at
+        'baud'.
+        """
+        old = self.ser.baudrate
+        if baud == old:
+            return True
+        print "%d baud, error %+.1f%%" % (baud, protocol.baudError(baud) * 100)
+        self.baudReply = None
+        self.sendFrame(protocol.baudFrame(self.sequence, baud))
+        deadline = time.time() + creditTimeout * 5
+        while self.baudReply is None and time.time() < deadline:
+            self.readCredits()
+        if self.baudReply != baud:
+            print "ROBOT REFUSED %d BAUD." % baud
+            return False
+        self.ser.baudrate = baud
+        self.reader = protocol.FrameReader()
+        deadline = time.time() + protocol.LINK_CONFIRM / 2
+        while time.time() < deadline:
+            self.sendFrame(protocol.creditRequestFrame(self.sequence))
+            if self.readCredits():
+                return True
+        print "NO ANSWER AT %d BAUD." % baud
+        self.ser.baudrate = old
+        time.sleep(protocol.LINK_CONFIRM) # Until the robot goes back too
+        return False
+
+    def readCredits(self):
+        """
+        Reads whatever the robot has sent, and updates 'self.credits' from
+        the last CMD_CREDIT frame. Returns True if one was received.
+        """
+        data = self.ser.read(max(1, self.ser.inWaiting()))
+        received = False
+        for (command, sequence, payload) in self.reader.feed(data):
+            if command == protocol.CMD_CREDIT and len(payload) == 1:
+                # Frames sent after the acknowledged one are not counted yet.
+                self.inFlight = [(s, n, b) for (s, n, b) in self.inFlight
+                                 if (sequence - s) & 0xFF >= 0x80]
+                self.credits = payload[0] - sum(n for (s, n, b) in
+                                                self.inFlight)
+                self.lastCredit = time.time()
+                received = True
+            elif command == protocol.CMD_STATS:
+                self.stats = protocol.parseStats(payload)
+            elif command == protocol.CMD_BAUD and len(payload) == 4:
+                self.baudReply = struct.unpack("<I", bytes(payload))[0]
+            elif command == protocol.CMD_LOG:
+                print "ROBOT: " + self.logDecoder.decode(payload)
+            elif command == protocol.CMD_TELEMETRY:
+                sample = protocol.parseTelemetry(payload)
+                if sample is not None:
+                    self.recordTelemetry(sample)
+        return received
+
+    def recordTelemetry(self, sample):
+        """
+        Keeps the telemetry 'sample' and the position it measured, and logs
+        it if 'telemetryLog' is set.
+        """
+        self.telemetry = sample
+        self.measuredPos = sample["position"]
+        if self.log:
+            position = sample["position"] or ("", "", "")
+            fields = ([sample["time"]] + list(sample["ticks"]) +
+                      list(sample["load"]) + list(sample["temperature"]) +
+                      list(position) + [sample["queued"], sample["errors"]])
+            self.log.write(",".join(str(f) for f in fields) + "\n")
+
+    def printStats(self):
+        """
+        Asks the robot for its tick timing statistics and prints them, if
+        'self.showStats' is set. Called from this thread, which owns the
+        serial port.
+        """
+        if not self.showStats or not self.serConnected or not useBinary:
+            return
+        self.showStats = False
+        self.stats = None
+        self.sendFrame(protocol.statsRequestFrame(self.sequence))
+        deadline = time.time() + 1.0
+        while self.stats is None and time.time() < deadline:
+            self.readCredits()
+        if self.stats is None:
+            print "NO STATS RECEIVED."
+        else:
+            for name in protocol.STATS_FIELDS:
+                print "%-15s %d" % (name, self.stats[name])
+        if self.telemetry is not None:
+            print "%-15s %s" % ("measured", self.measuredPos)
+            print "%-15s %s" % ("load", self.telemetry["load"])
+            print "%-15s %s" % ("temperature", self.telemetry["temperature"])
+            print "%-15s %d" % ("queued", self.telemetry["queued"])
+
+    def waitForCredit(self, setpoints = 1):
+        """
+        Blocks until the robot has room for 'setpoints' more setpoints. Asks
+        for a credit if none arrives in 'creditTimeout' (e.g. after a reset).
+        Returns False if the thread was stopped while waiting.
+        """
+        while self.credits < setpoints:
+            if self.stop:
+                return False
+            if not self.readCredits():
+                self.sendFrame(protocol.creditRequestFrame(self.sequence))
+        return True
+
     def listenToHand(self):
         """
         Listens to hand position information and outputs it to the Delta.
+        Returns True if a new position was sent.
         """
         posOut = self.currentPos # Position to be outputted to move to.
                                  # By default, output current position
@@ -284,20 +623,23 @@ class ControllerThread(threading.Thread):
         if pos != (0.0, 0.0, 0.0): # Data from LeapMotion is good            
             desiredPos = transformPoint(pos) # Desired move position
 ####            print "DESIRED:    " + str(desiredPos)
-            boundedPos = boundDestination(self.currentPos, desiredPos)
+            boundedPos = clamp.boundDestination(self.currentPos, desiredPos)
 ####            print "BOUNDED:    " + str(boundedPos)
-            restrainedPos = restrainMove(self.currentPos, boundedPos)
+            restrainedPos = clamp.restrainMove(self.currentPos, boundedPos,
+                                               restrainThresh, restrainDist)
                 # Make move distance no more than 1" for mechanism safety.
 ####            print "RESTRAINED: " + str(restrainedPos
 ####            print "\n"
             posOut = restrainedPos
 
-        # SEND 'posOut' TO THE ROBOT, if serial connected.
-        if self.serConnected:
-            self.outputPosition(posOut)
+        # SEND 'posOut' TO THE ROBOT, if serial connected and the robot has
+        # caught up.
+        if self.serConnected and not self.outputLivePosition(posOut):
+            return False
         print "%.3f   %.3f   %.3f" % (posOut[x], posOut[y], posOut[z])
 
         self.currentPos = posOut # Save position just sent to robot.
+        return True
     
     def run(self):
         """
@@ -310,18 +652,22 @@ class ControllerThread(threading.Thread):
         # Hand Tracking.
         if self.handTrack:
             while not self.stop:
-                self.listenToHand()
-                if self.record:
+                sent = self.listenToHand()
+                self.printStats()
+                if self.record and sent:
                     if posCount < MAX_POS:
                         positions.append(self.currentPos)
                         posCount += 1
             if self.playback:
-                print("'p' to playback - Enter to cancel")
+                print("'p' to playback, 's' for stats - Enter to cancel")
                 self.stop = False # Resets -- awaiting a new True command
                 # Needs to dwell and wait for response from main thread.
                 while not self.stop:
+                    self.printStats()
                     if self.replay:
                         self.replay = False
                         self.outputImage(positions)
         
         self.ser.close() # Close serial after thread is killed.
+        if self.log:
+            self.log.close()
@@ -0,0 +1,76 @@
+import os
+import re
+import struct
+import sys
+import time
+import serial
+import protocol
+
+#
+# Decodes the tokenized log of the Delta Robot (see
+# DeltaDriver/DeltaDriver/debuglog.h). The robot sends CMD_LOG frames holding
+# a message ID and its raw arguments; the signatures and format strings come
+# from the same logmessages.h the firmware was built with.
+#
+# Usage: python logdecode.py <port>
+#   Prints every message the robot logs, until interrupted.
+#
+
+MESSAGES_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             "..", "DeltaDriver", "DeltaDriver",
+                             "logmessages.h")
+baudrate = 57600
+
+entry = re.compile(r'^\s*LOG_MESSAGE\(\s*(\w+)\s*,\s*"([bBhHlLf]*)"\s*,'
+                   r'\s*"((?:[^"\\]|\\.)*)"\s*\)', re.MULTILINE)
+
+def loadMessages(path = MESSAGES_FILE):
+    """
+    Returns the list of (name, signature, format) of the messages in the
+    logmessages.h at 'path', indexed by ID.
+    """
+    with open(path) as f:
+        return entry.findall(f.read())
+
+class LogDecoder(object):
+    """
+    Turns CMD_LOG payloads back into text.
+    """
+
+    def __init__(self, path = MESSAGES_FILE):
+        self.messages = loadMessages(path)
+
+    def decode(self, payload):
+        """
+        Returns the text of the CMD_LOG 'payload'.
+        """
+        payload = bytearray(payload)
+        if len(payload) == 0 or payload[0] >= len(self.messages):
+            return "Unknown log message %r" % payload
+        name, signature, form = self.messages[payload[0]]
+        try:
+            args = struct.unpack("<" + signature, bytes(payload[1:]))
+            return form % args
+        except (struct.error, TypeError, ValueError):
+            return "%s: bad arguments %r" % (name, payload[1:])
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("Usage: python logdecode.py <port>")
+        sys.exit(1)
+    decoder = LogDecoder()
+    reader = protocol.FrameReader()
+    ser = serial.Serial()
+    ser.baudrate = baudrate
+    ser.port = int(sys.argv[1]) if sys.argv[1].isdigit() else sys.argv[1]
+    ser.timeout = 0.1
+    ser.open()
+    time.sleep(0.1) # Wait for serial to open
+    try:
+        while True:
+            for (command, sequence, payload) in reader.feed(ser.read(64)):
+                if command == protocol.CMD_LOG:
+                    print("%3d %s" % (sequence, decoder.decode(payload)))
+    except KeyboardInterrupt:
+        pass
+    ser.close()
@@ -8,12 +8,16 @@ from controller import *
 
 def loop():
     """
-    Keeps looping until user enters something besides a playback command.
+    Keeps looping until user enters something besides a playback or stats
+    command.
     """
     message = raw_input()
     if message == 'p':
         ct.replay = True
         loop()
+    elif message == 's':
+        ct.showStats = True
+        loop()
     else:
         ct.stop = True
 
@@ -0,0 +1,328 @@
+import struct
+
+#
+# Implements the binary framed command protocol of the Delta Robot (see
+# DeltaDriver/DeltaDriver/protocol.h). A frame on the wire is a zero byte, the
+# COBS encoding of [command, sequence, payload..., crc low, crc high], and a
+# zero byte. Multi-byte fields are little-endian.
+#
+
+FRAME_DELIMITER = 0x00
+
+CMD_POSITION = 0x01 # int16 x, y, z in thousandths of an inch.
+CMD_ANGLE    = 0x02 # uint16 goal ticks of servos 1, 2, 3.
+CMD_WAYPOINTS = 0x03 # Up to WAYPOINTS_MAX of int16 x, y, z in thousandths of
+                     # an inch and uint16 ms to the next waypoint.
+CMD_LINE     = 0x04 # int16 x, y, z in thousandths of an inch and uint16 feed
+                    # rate in thousandths of an inch per second.
+CMD_BEZIER   = 0x05 # int16 x, y, z of control points 1, 2 and the end point in
+                    # thousandths of an inch, and uint16 duration in ms.
+CMD_ARC      = 0x06 # int16 centre x, y and end x, y, z in thousandths of an
+                    # inch, uint16 feed rate in thousandths of an inch per
+                    # second, and uint8 1 if counter-clockwise.
+CMD_CREDIT   = 0x10 # Host: empty. Robot: uint8 free queue slots, and the
+                    # sequence of the last frame it received. The host also
+                    # keeps the bytes of frames not yet acknowledged within
+                    # RX_BUFFER, so a slow tick cannot overrun the robot.
+CMD_STATS    = 0x11 # Host: empty, or uint8 1 to also clear. Robot: STATS_FIELDS.
+CMD_RATE     = 0x12 # uint16 servo tick rate in Hz (100 - 500).
+CMD_LIMITS   = 0x13 # uint16 max velocity in thousandths of an inch/s, uint16
+                    # max acceleration in thousandths of an inch/s^2, uint8
+                    # profile.
+CMD_TELEMETRY = 0x14 # Host: uint16 samples per second, 0 to stop. Robot:
+                     # TELEMETRY_FORMAT, a sequence counting these frames.
+CMD_LOG      = 0x15 # Robot: uint8 message ID and its arguments (logdecode.py).
+CMD_TRACE    = 0x16 # Host: empty, or uint8 1 to also clear. Robot: uint8 index
+                    # of the first entry, uint8 entries in all, and entries of
+                    # uint8 event, uint8 arg, uint16 time (tracehist.py).
+CMD_BAUD     = 0x17 # Host: uint32 baud rate. Robot, at the old rate: uint32 the
+                    # rate it switches to, or 0 if it cannot.
+CMD_GCODE    = 0x18 # uint8 1 to read ASCII bytes outside of '$' and '%'
+                    # commands as G-code, 0 to ignore them (the default).
+
+PROFILE_TRAPEZOID = 0 # Constant acceleration ramps.
+PROFILE_SCURVE    = 1 # Smoothstep ramps, bounded jerk.
+
+# Fields of a CMD_STATS reply, each a uint16. Times are in microseconds.
+STATS_FIELDS = ("rate", "ticks", "overruns", "maxLatency", "maxDuration",
+                "lastDuration", "frameErrors", "queueOverflows",
+                "logDropped", "goalWaits")
+
+# A CMD_TELEMETRY sample: uint32 time in us, uint16 present ticks and loads of
+# servos 1, 2, 3, uint8 temperatures in C, int16 x, y, z in thousandths of an
+# inch (TELEMETRY_NO_POSITION if unknown), uint8 queued setpoints and uint8
+# bit per servo that did not answer.
+TELEMETRY_FORMAT = "<I3H3H3B3hBB"
+TELEMETRY_NO_POSITION = -0x8000
+
+DEFAULT_BAUD = 57600   # Host link baud rate after a reset.
+LINK_CONFIRM = 0.5     # seconds the robot waits for a frame at a new rate.
+
+QUEUE_CAPACITY = 31 # Setpoints the robot can hold (QUEUE_CAPACITY in queue.h).
+RX_BUFFER      = 127 # Bytes the robot's serial receive ring holds (serial.c).
+WAYPOINTS_MAX  = 8  # Waypoints per CMD_WAYPOINTS frame.
+
+def crc16(data, crc = 0xFFFF):
+    """
+    Returns the CRC-16/CCITT (reflected, polynomial 0x8408) of the bytearray
+    'data', starting from 'crc'. Matches _crc_ccitt_update in avr-libc.
+    """
+    for byte in data:
+        byte ^= crc & 0xFF
+        byte = (byte ^ (byte << 4)) & 0xFF
+        crc = (((byte << 8) | (crc >> 8)) ^ (byte >> 4) ^ (byte << 3)) & 0xFFFF
+    return crc
+
+def cobsEncode(data):
+    """
+    Returns the COBS encoding of the bytearray 'data' as a bytearray.
+    """
+    out = bytearray([0])
+    codeIndex = 0
+    code = 1
+    for byte in data:
+        if byte == 0:
+            out[codeIndex] = code
+            codeIndex = len(out)
+            out.append(0)
+            code = 1
+        else:
+            out.append(byte)
+            code += 1
+            if code == 0xFF:
+                out[codeIndex] = code
+                codeIndex = len(out)
+                out.append(0)
+                code = 1
+    out[codeIndex] = code
+    return out
+
+def cobsDecode(data):
+    """
+    Returns the decoding of the COBS encoded bytearray 'data', or None if it
+    is not valid COBS.
+    """
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return out
+
+def encodeFrame(command, sequence, payload):
+    """
+    Returns the frame carrying 'command', 'sequence' (0 - 255) and the
+    bytearray 'payload', delimiters included, ready to be written.
+    """
+    data = bytearray([command, sequence & 0xFF]) + bytearray(payload)
+    crc = crc16(data)
+    data += bytearray([crc & 0xFF, crc >> 8])
+    return bytes(bytearray([FRAME_DELIMITER]) + cobsEncode(data) +
+                 bytearray([FRAME_DELIMITER]))
+
+def decodeFrame(frame):
+    """
+    Returns (command, sequence, payload) for the bytes of one frame between
+    its delimiters, or None if it is corrupt.
+    """
+    data = cobsDecode(bytearray(frame))
+    if data is None or len(data) < 4 or crc16(data) != 0:
+        return None
+    return (data[0], data[1], data[2:-2])
+
+def thou(value):
+    """
+    Returns 'value' in inches as a whole number of thousandths of an inch.
+    """
+    return int(round(value * 1000))
+
+def positionFrame(sequence, p):
+    """
+    Returns a CMD_POSITION frame for the point 'p' = (x, y, z) in inches.
+    """
+    (x, y, z) = p
+    return encodeFrame(CMD_POSITION, sequence,
+                       struct.pack("<hhh", thou(x), thou(y), thou(z)))
+
+def angleFrame(sequence, ticks):
+    """
+    Returns a CMD_ANGLE frame for the servo goal ticks 'ticks' = (t1, t2, t3).
+    """
+    return encodeFrame(CMD_ANGLE, sequence, struct.pack("<HHH", *ticks))
+
+def creditRequestFrame(sequence):
+    """
+    Returns a CMD_CREDIT frame asking the robot how many slots are free.
+    """
+    return encodeFrame(CMD_CREDIT, sequence, bytearray())
+
+def waypointsFrame(sequence, points, durations):
+    """
+    Returns a CMD_WAYPOINTS frame for the list 'points' of (x, y, z) in
+    inches, each held for the matching entry of 'durations' in milliseconds
+    before the robot moves on. At most WAYPOINTS_MAX points.
+    """
+    payload = bytearray()
+    for ((x, y, z), duration) in zip(points, durations):
+        payload += struct.pack("<hhhH", thou(x), thou(y), thou(z),
+                               int(round(duration)))
+    return encodeFrame(CMD_WAYPOINTS, sequence, payload)
+
+def lineFrame(sequence, p, feed):
+    """
+    Returns a CMD_LINE frame for a straight line from wherever the robot is
+    to 'p' = (x, y, z) in inches, at 'feed' inches per second.
+    """
+    (x, y, z) = p
+    return encodeFrame(CMD_LINE, sequence,
+                       struct.pack("<hhhH", thou(x), thou(y), thou(z),
+                                   min(thou(feed), 0xFFFF)))
+
+def bezierFrame(sequence, p1, p2, p3, duration):
+    """
+    Returns a CMD_BEZIER frame for a cubic Bezier curve from wherever the
+    robot is, with control points 'p1' and 'p2', to 'p3', all (x, y, z) in
+    inches, taking 'duration' milliseconds.
+    """
+    payload = bytearray()
+    for (x, y, z) in (p1, p2, p3):
+        payload += struct.pack("<hhh", thou(x), thou(y), thou(z))
+    payload += struct.pack("<H", int(round(duration)))
+    return encodeFrame(CMD_BEZIER, sequence, payload)
+
+def arcFrame(sequence, centre, p, feed, ccw):
+    """
+    Returns a CMD_ARC frame for an arc in the XY-plane from wherever the robot
+    is, about 'centre' = (x, y), to 'p' = (x, y, z), in inches, at 'feed'
+    inches per second, counter-clockwise if 'ccw'. Ending where it starts
+    draws a full circle.
+    """
+    payload = struct.pack("<hhhhhHB", thou(centre[0]), thou(centre[1]),
+                          thou(p[0]), thou(p[1]), thou(p[2]),
+                          int(round(feed * 1000)), 1 if ccw else 0)
+    return encodeFrame(CMD_ARC, sequence, bytearray(payload))
+
+def statsRequestFrame(sequence, clear = False):
+    """
+    Returns a CMD_STATS frame asking for the tick statistics, and clearing
+    them after the reply if 'clear' is True.
+    """
+    return encodeFrame(CMD_STATS, sequence, bytearray([1 if clear else 0]))
+
+def rateFrame(sequence, hz):
+    """
+    Returns a CMD_RATE frame setting the servo tick rate to 'hz'.
+    """
+    return encodeFrame(CMD_RATE, sequence, struct.pack("<H", hz))
+
+def limitsFrame(sequence, velocity, acceleration, profile):
+    """
+    Returns a CMD_LIMITS frame setting the velocity (in/s) and acceleration
+    (in/s^2) limits of lines, and their 'profile' (PROFILE_TRAPEZOID or
+    PROFILE_SCURVE).
+    """
+    return encodeFrame(CMD_LIMITS, sequence,
+                       struct.pack("<HHB", min(thou(velocity), 0xFFFF),
+                                   min(thou(acceleration), 0xFFFF), profile))
+
+def baudFrame(sequence, baud):
+    """
+    Returns a CMD_BAUD frame asking the robot to switch to 'baud'.
+    """
+    return encodeFrame(CMD_BAUD, sequence, struct.pack("<I", baud))
+
+def gcodeModeFrame(sequence, on):
+    """
+    Returns a CMD_GCODE frame turning G-code mode on or off.
+    """
+    return encodeFrame(CMD_GCODE, sequence, bytearray([1 if on else 0]))
+
+def baudError(baud):
+    """
+    Returns the relative error of the robot's nearest baud rate to 'baud': its
+    USART runs at double speed from a 16 MHz clock.
+    """
+    divisor = max(1, int(2000000.0 / baud + 0.5))
+    return (2000000.0 / divisor - baud) / baud
+
+def parseStats(payload):
+    """
+    Returns the CMD_STATS reply 'payload' as a dictionary keyed by
+    STATS_FIELDS.
+    """
+    values = struct.unpack("<%dH" % len(STATS_FIELDS), bytes(payload))
+    return dict(zip(STATS_FIELDS, values))
+
+def telemetryRateFrame(sequence, hz):
+    """
+    Returns a CMD_TELEMETRY frame asking for 'hz' samples per second, or for
+    none if 'hz' is 0.
+    """
+    return encodeFrame(CMD_TELEMETRY, sequence, struct.pack("<H", hz))
+
+def parseTelemetry(payload):
+    """
+    Returns the CMD_TELEMETRY 'payload' as a dictionary with the time in
+    seconds, and per servo the ticks, signed load (-1023 - 1023) and
+    temperature. 'position' is (x, y, z) in inches, or None if the robot
+    could not solve it. Returns None if 'payload' is not a sample.
+    """
+    if len(payload) != struct.calcsize(TELEMETRY_FORMAT):
+        return None
+    values = struct.unpack(TELEMETRY_FORMAT, bytes(payload))
+    # Bit 10 set is a clockwise load, taken as negative.
+    loads = [-(l & 0x3FF) if l & 0x400 else l & 0x3FF for l in values[4:7]]
+    position = None
+    if TELEMETRY_NO_POSITION not in values[10:13]:
+        position = tuple(v / 1000.0 for v in values[10:13])
+    return {"time": values[0] / 1e6, "ticks": values[1:4], "load": loads,
+            "temperature": values[7:10], "position": position,
+            "queued": values[13], "errors": values[14]}
+
+def traceRequestFrame(sequence, clear = False):
+    """
+    Returns a CMD_TRACE frame asking for the event trace, and clearing it
+    after the reply if 'clear' is True.
+    """
+    return encodeFrame(CMD_TRACE, sequence, bytearray([1 if clear else 0]))
+
+def parseTrace(payload):
+    """
+    Returns the CMD_TRACE reply 'payload' as (index of the first entry,
+    entries in all, list of (event, arg, time)).
+    """
+    payload = bytearray(payload)
+    entries = [struct.unpack("<BBH", bytes(payload[i:i + 4]))
+               for i in range(2, len(payload) - 3, 4)]
+    return (payload[0], payload[1], entries)
+
+class FrameReader(object):
+    """
+    Splits the bytes received from the robot into frames. Bytes outside of a
+    frame (e.g. printf text) are dropped.
+    """
+
+    def __init__(self):
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        """
+        Adds the received bytes 'data' and returns the list of
+        (command, sequence, payload) of every valid frame they completed.
+        """
+        frames = []
+        for byte in bytearray(data):
+            if byte != FRAME_DELIMITER:
+                self.buffer.append(byte)
+                continue
+            if len(self.buffer) > 0:
+                frame = decodeFrame(self.buffer)
+                if frame is not None:
+                    frames.append(frame)
+            self.buffer = bytearray()
+        return frames
@@ -0,0 +1,109 @@
+import re
+import sys
+import time
+import serial
+import protocol
+
+#
+# Streams a G-code file to the Delta Robot, which interprets it on board (see
+# DeltaDriver/DeltaDriver/gcode.h) between two CMD_GCODE frames that turn its
+# G-code mode on and off. The robot answers every line with "ok" or
+# "error:<code>" once the line is queued, and leaves later bytes in its serial
+# receive buffer meanwhile. The streamer counts the bytes of the lines not yet
+# answered and keeps them within that buffer, so the link stays full without
+# ever overflowing it.
+#
+# Usage: python stream.py <port> <file>
+#   'port' is a port name, or a number as in controller.py (COM port - 1).
+#
+
+RX_BUFFER = 127    # Bytes the robot's receive buffer holds (serial.c).
+baudrate  = 57600
+timeout   = 5.0    # seconds to wait for an answer before giving up.
+
+ERRORS = {1: "syntax", 2: "unsupported word", 3: "bad arc"}
+
+reply = re.compile(r"(ok|error:(\d+))\r?$")
+
+def cleanLine(line):
+    """
+    Returns 'line' without comments and whitespace, in upper case. Returns ''
+    if nothing is left, or for a '%' program marker, which the robot reads as
+    the start of an ASCII command.
+    """
+    line = re.sub(r"\([^)]*\)", "", line)
+    line = line.split(";")[0]
+    line = "".join(line.split()).upper()
+    if line.startswith("%"):
+        return ""
+    return line
+
+def readReply(ser):
+    """
+    Reads lines from 'ser' until one is an answer, and returns its error code
+    (0 for "ok"). Other bytes, such as credit frames, are skipped.
+    """
+    start = time.time()
+    while time.time() - start < timeout:
+        line = ser.readline().decode("latin-1")
+        match = reply.search(line)
+        if match:
+            return int(match.group(2)) if match.group(2) else 0
+    raise IOError("No answer from the robot.")
+
+def stream(ser, lines):
+    """
+    Streams the G-code 'lines' through the open serial port 'ser'. Returns the
+    number of lines the robot rejected.
+    """
+    pending = [] # (line number, text) of lines not yet answered.
+    errors = 0
+    size = 0
+    for number, line in enumerate(lines, 1):
+        text = cleanLine(line)
+        if not text:
+            continue
+        text += "\n"
+        if len(text) > RX_BUFFER:
+            print("Line %d is too long, skipped." % number)
+            errors += 1
+            continue
+        while size + len(text) > RX_BUFFER:
+            errors += answer(ser, pending)
+            size = sum(len(t) for n, t in pending)
+        ser.write(text.encode("ascii"))
+        pending.append((number, text))
+        size += len(text)
+    while pending:
+        errors += answer(ser, pending)
+    return errors
+
+def answer(ser, pending):
+    """
+    Reads the answer to the oldest line in 'pending' from 'ser' and drops the
+    line. Returns 1 if the robot rejected it, 0 otherwise.
+    """
+    number, text = pending.pop(0)
+    code = readReply(ser)
+    if code == 0:
+        return 0
+    print("Line %d: %s (%s)" % (number, text.strip(), ERRORS.get(code, code)))
+    return 1
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print("Usage: python stream.py <port> <file>")
+        sys.exit(1)
+    ser = serial.Serial()
+    ser.baudrate = baudrate
+    ser.port = int(sys.argv[1]) if sys.argv[1].isdigit() else sys.argv[1]
+    ser.timeout = 0.1
+    ser.open()
+    time.sleep(0.1) # Wait for serial to open
+    start = time.time()
+    ser.write(protocol.gcodeModeFrame(0, True))
+    with open(sys.argv[2]) as f:
+        errors = stream(ser, f)
+    ser.write(protocol.gcodeModeFrame(1, False))
+    print("Streamed in %.1f s, %d errors." % (time.time() - start, errors))
+    ser.close()
@@ -0,0 +1,110 @@
+import sys
+import time
+import serial
+import protocol
+
+#
+# Dumps the event trace of the Delta Robot (see DeltaDriver/DeltaDriver/
+# trace.h) and prints a latency histogram for each stage: host frames from
+# their first byte, servo ticks, inverse kinematics, and Dynamixel packets
+# out and back. Run it while the robot is moving; the trace holds the last
+# TRACE_DEPTH events.
+#
+# Usage: python tracehist.py <port>
+#
+
+baudrate = 57600
+timeout  = 2.0     # seconds to wait for the whole dump.
+
+TIMER_HZ = 2000000.0 # Trace timestamp clock (TRACE_TIMER_HZ).
+
+# Events of trace.h.
+NONE, BYTE, FRAME, TICK_START, TICK_END, IK_START, IK_END = range(7)
+DXL_TX_START, DXL_TX_END, DXL_RX_START, DXL_RX_END, DXL_RX_TIMEOUT = \
+    range(7, 12)
+
+# Stages: name, start events, end events. A stage lasts from the first start
+# event after the last end to the next end event.
+STAGES = (("frame",  (BYTE,),         (FRAME,)),
+          ("tick",   (TICK_START,),   (TICK_END,)),
+          ("ik",     (IK_START,),     (IK_END,)),
+          ("dxl tx", (DXL_TX_START,), (DXL_TX_END,)),
+          ("dxl rx", (DXL_RX_START,), (DXL_RX_END, DXL_RX_TIMEOUT)))
+
+def dumpTrace(ser):
+    """
+    Asks the robot for its trace through the open serial port 'ser', and
+    returns the list of (event, arg, time), oldest first.
+    """
+    reader = protocol.FrameReader()
+    ser.write(protocol.traceRequestFrame(0))
+    entries = {}
+    total = None
+    deadline = time.time() + timeout
+    while time.time() < deadline and (total is None or len(entries) < total):
+        for (command, sequence, payload) in reader.feed(ser.read(64)):
+            if command != protocol.CMD_TRACE:
+                continue
+            first, total, chunk = protocol.parseTrace(payload)
+            for i, entry in enumerate(chunk):
+                entries[first + i] = entry
+    if total is None or len(entries) < total:
+        raise IOError("Incomplete trace from the robot.")
+    return [entries[i] for i in range(total) if entries[i][0] != NONE]
+
+def stageLatencies(trace):
+    """
+    Returns a dictionary of the durations in microseconds of each stage in
+    the 'trace', and the number of Dynamixel RX timeouts.
+    """
+    latencies = dict((name, []) for (name, starts, ends) in STAGES)
+    for (name, starts, ends) in STAGES:
+        start = None
+        for (event, arg, stamp) in trace:
+            if event in starts and start is None:
+                start = stamp
+            elif event in ends and start is not None:
+                latencies[name].append(((stamp - start) & 0xFFFF) * 1e6 /
+                                       TIMER_HZ)
+                start = None
+    timeouts = sum(1 for (event, arg, stamp) in trace
+                   if event == DXL_RX_TIMEOUT)
+    return latencies, timeouts
+
+def printHistogram(name, values, width = 40):
+    """
+    Prints a histogram of 'values' in microseconds, in power-of-two bins.
+    """
+    print("%s: %d samples" % (name, len(values)))
+    if not values:
+        return
+    bins = {}
+    for v in values:
+        b = 1
+        while b * 2 <= v:
+            b *= 2
+        bins[b] = bins.get(b, 0) + 1
+    most = max(bins.values())
+    for b in sorted(bins):
+        label = "%d-%d us" % (b if b > 1 else 0, b * 2)
+        print("  %14s %-*s %d" % (label, width, "#" * (bins[b] * width // most),
+                                  bins[b]))
+    print("  min %.1f  mean %.1f  max %.1f us" %
+          (min(values), sum(values) / len(values), max(values)))
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("Usage: python tracehist.py <port>")
+        sys.exit(1)
+    ser = serial.Serial()
+    ser.baudrate = baudrate
+    ser.port = int(sys.argv[1]) if sys.argv[1].isdigit() else sys.argv[1]
+    ser.timeout = 0.1
+    ser.open()
+    time.sleep(0.1) # Wait for serial to open
+    trace = dumpTrace(ser)
+    ser.close()
+    latencies, timeouts = stageLatencies(trace)
+    for (name, starts, ends) in STAGES:
+        printHistogram(name, latencies[name])
+    print("dxl rx timeouts: %d" % timeouts)
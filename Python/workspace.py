@@ -84,6 +84,156 @@ def penInPrism(p):
     return (pointValid(p) and inRectangle(p) and zPen >= Z_PAPER 
             and zPen <= Z_CLAMP)
 
+# 
+# SIGNED DISTANCE FIELD.
+# 
+# The pen workspace is the union of the cylinder above the clamps and the
+# prism above the paper. Its signed distance (positive outside) is sampled on
+# the same grid as SDF_TABLE in DeltaDriver/workspace.h, so the host and the
+# firmware project points identically. The grid only covers the quadrant
+# x >= 0, y >= 0, since the workspace is symmetric in x and y.
+# 
+SDF_XY_MAX    =   6.50 # Maximum |x| and |y| in the table.
+SDF_Z_MIN     = -13.00 # Minimum z-value in the table.
+SDF_Z_MAX     =  -7.50 # Maximum z-value in the table.
+SDF_RES       =   0.25 # Resolution of the table on every axis.
+SDF_SCALE     = 1000.0 # Table entries are in thousandths of an inch.
+SDF_TOLERANCE =  0.002 # Distance counted as on the boundary.
+SDF_MARGIN    =  0.001 # Extra step into the workspace.
+SDF_MAX_STEPS =      3 # Gradient steps per projection.
+SDF_XY_DIM    = int(SDF_XY_MAX / SDF_RES + 1)
+SDF_Z_DIM     = int((SDF_Z_MAX - SDF_Z_MIN) / SDF_RES + 1)
+
+def workspaceDistance(p):
+    """
+    Returns the exact signed distance from the point 'p' = (x, y, z) to the 
+    boundary of the pen workspace, in inches. Negative inside.
+    """
+    (x, y, z) = p
+    # Cylinder above the clamps.
+    dr = sqrt(x ** 2 + y ** 2) - R_MAX
+    dz = max(Z_CLAMP + PEN_DIST - z, z - Z_MAX)
+    dCylinder = (sqrt(max(dr, 0) ** 2 + max(dz, 0) ** 2) + 
+                 min(max(dr, dz), 0))
+    # Prism above the paper.
+    dx = abs(x) - X_RCT_MAX
+    dy = abs(y) - Y_RCT_MAX
+    dz = max(max(Z_PAPER + PEN_DIST, Z_MIN) - z, z - (Z_CLAMP + PEN_DIST))
+    dPrism = (sqrt(max(dx, 0) ** 2 + max(dy, 0) ** 2 + max(dz, 0) ** 2) +
+              min(max(dx, dy, dz), 0))
+    return min(dCylinder, dPrism)
+
+def generateSdfTable():
+    """
+    Returns the signed-distance table as a flat list of integers in 
+    thousandths of an inch, indexed by sdfIndex.
+    """
+    table = []
+    for xIndex in range(SDF_XY_DIM):
+        for yIndex in range(SDF_XY_DIM):
+            for zIndex in range(SDF_Z_DIM):
+                p = (SDF_RES * xIndex, SDF_RES * yIndex, 
+                     SDF_Z_MIN + SDF_RES * zIndex)
+                table.append(int(round(workspaceDistance(p) * SDF_SCALE)))
+    return table
+
+def sdfIndex(xIndex, yIndex, zIndex):
+    """
+    Returns the index in SDF_TABLE of the lattice point (xIndex, yIndex, 
+    zIndex).
+    """
+    return (xIndex * SDF_XY_DIM + yIndex) * SDF_Z_DIM + zIndex
+
+SDF_TABLE = generateSdfTable()
+
+def sdfLookup(p):
+    """
+    Returns (d, gradient), the signed distance from the point 'p' = (x, y, z) 
+    to the pen workspace by trilinear interpolation of SDF_TABLE, and its 
+    gradient [gx, gy, gz]. Points outside the table are evaluated at the
+    nearest table point.
+    """
+    (x, y, z) = p
+    # Fold into the first quadrant and clamp to the table.
+    xc = min(abs(x), SDF_XY_MAX)
+    yc = min(abs(y), SDF_XY_MAX)
+    zc = min(max(z, SDF_Z_MIN), SDF_Z_MAX)
+    
+    xInd = min(int(xc / SDF_RES), SDF_XY_DIM - 2)
+    yInd = min(int(yc / SDF_RES), SDF_XY_DIM - 2)
+    zInd = min(int((zc - SDF_Z_MIN) / SDF_RES), SDF_Z_DIM - 2)
+    xProp = xc / SDF_RES - xInd
+    yProp = yc / SDF_RES - yInd
+    zProp = (zc - SDF_Z_MIN) / SDF_RES - zInd
+    
+    # 'cijk' is the corner (xInd + i, yInd + j, zInd + k).
+    i = sdfIndex(xInd, yInd, zInd)
+    dx = SDF_XY_DIM * SDF_Z_DIM
+    dy = SDF_Z_DIM
+    (c000, c001) = (SDF_TABLE[i], SDF_TABLE[i + 1])
+    (c010, c011) = (SDF_TABLE[i + dy], SDF_TABLE[i + dy + 1])
+    (c100, c101) = (SDF_TABLE[i + dx], SDF_TABLE[i + dx + 1])
+    (c110, c111) = (SDF_TABLE[i + dx + dy], SDF_TABLE[i + dx + dy + 1])
+    
+    # Collapse the x-axis, then y, then z.
+    c00 = c000 + xProp * (c100 - c000)
+    c01 = c001 + xProp * (c101 - c001)
+    c10 = c010 + xProp * (c110 - c010)
+    c11 = c011 + xProp * (c111 - c011)
+    c0 = c00 + yProp * (c10 - c00)
+    c1 = c01 + yProp * (c11 - c01)
+    
+    # Gradient of the interpolant, in inches per inch.
+    scale = SDF_SCALE * SDF_RES
+    gx = ((1 - zProp) * ((1 - yProp) * (c100 - c000) + yProp * (c110 - c010)) +
+          zProp * ((1 - yProp) * (c101 - c001) + yProp * (c111 - c011))) / scale
+    gy = ((1 - zProp) * (c10 - c00) + zProp * (c11 - c01)) / scale
+    gz = (c1 - c0) / scale
+    if x < 0:
+        gx = -gx
+    if y < 0:
+        gy = -gy
+    
+    return ((c0 + zProp * (c1 - c0)) / SDF_SCALE, [gx, gy, gz])
+
+def projectToWorkspace(p):
+    """
+    Returns the point (x, y, z) of the pen workspace closest to 'p'. Points 
+    inside the workspace are returned unchanged; points outside are moved down
+    the gradient of the signed-distance field by their distance to the 
+    boundary, then clamped exactly onto the faces, so the result always passes
+    penPointValid.
+    """
+    (x, y, z) = p
+    # Start from the nearest point of the table.
+    x = min(max(x, -SDF_XY_MAX), SDF_XY_MAX)
+    y = min(max(y, -SDF_XY_MAX), SDF_XY_MAX)
+    z = min(max(z, SDF_Z_MIN), SDF_Z_MAX)
+    
+    for step in range(SDF_MAX_STEPS):
+        (d, (gx, gy, gz)) = sdfLookup((x, y, z))
+        n = sqrt(gx ** 2 + gy ** 2 + gz ** 2)
+        if d <= SDF_TOLERANCE or n < 0.001:
+            break
+        d = (d + SDF_MARGIN) / n
+        (x, y, z) = (x - d * gx, y - d * gy, z - d * gz)
+    
+    # The interpolated field stops up to SDF_TOLERANCE outside, and near the
+    # concave edge where the prism meets the bottom of the cylinder its
+    # gradient is a blend of the two faces. Points left below the clamps
+    # outside the paper finish on the bottom of the cylinder; the rest are
+    # clamped onto the nearest face.
+    z = min(z, Z_MAX)
+    if z - PEN_DIST < Z_CLAMP:
+        if not inRectangle((x, y, z)):
+            z = Z_CLAMP + PEN_DIST
+        else:
+            z = max(z, Z_PAPER + PEN_DIST, Z_MIN)
+    if not inCircle((x, y, z)):
+        r = sqrt(x ** 2 + y ** 2)
+        (x, y) = (x * (R_MAX - SDF_MARGIN) / r, y * (R_MAX - SDF_MARGIN) / r)
+    return (x, y, z)
+
 def boundByCircle(p):
     """
     Returns the (x, y, z) value closest to the specified point 'p' = (x, y, z)
@@ -123,66 +273,71 @@ def boundByRectangle(p):
 def boundDestination(pStart, pEnd):
     """
     Returns a point (x, y, z) that limits the point 'pEnd' = (x, y, z) to the
-    boundary of the workspace. 
-    Safe operations:
+    boundary of the workspace. Out-of-bounds points are projected onto the
+    workspace with the signed-distance field (see projectToWorkspace). The 
+    result is then kept reachable by a straight move from 'pStart':
       START                                END
-      In cylinder                 ->       In cylinder
-      In cylinder                 ->       Circular wall of cylinder
-      In cylinder                 ->       Top of cylinder
-      In cylinder outside rect    ->       Bottom of cylinder 
-      In cylinder inside rect     ->       Bottom of prism inside rect
-      In cylinder inside rect     ->       Bottom of cylinder outside rect
-      In prism                    ->       In prism
-      In prism                    ->       Retangular wall of prism
-      In prism                    ->       Bottom of prism
-      In prism                    ->       Top of cylinder inside rect 
+      In cylinder outside rect    ->       Not below the clamps
+      In prism (below clamps)     ->       Inside rect
     """
-    (xStart, yStart, zStart) = pStart
-    zPenStart = zStart - PEN_DIST
-    
-    (xEnd, yEnd, zEnd) = pEnd
-    zPenEnd = zEnd - PEN_DIST
-    
-    (xOut, yOut, zOut) = (0, 0, 0)
-    
-    if penInCylinder(pStart):
-        if penInCylinder(pEnd):
-            (xOut, yOut, zOut) = pEnd
-        else: 
-            # Project xy onto outer circle:
-            (xOut, yOut, zOut) = boundByCircle(pEnd)
-            # Deal with z issues:
-            if zEnd > Z_MAX: # Deal with z
-                zOut = Z_MAX
-            if not inRectangle(pStart):
-                if zPenEnd < Z_CLAMP:
-                    zOut = Z_CLAMP + PEN_DIST
-            else: # if pStart is in rectangle
-                if zPenEnd < Z_CLAMP:
-                    if inRectangle(pEnd):
-                        if zPenEnd < Z_PAPER:
-                            zOut = Z_PAPER + PEN_DIST
-                    else: # if pEnd is not in rectangle
-                        zOut = Z_CLAMP + PEN_DIST
-    elif penInPrism(pStart):
-        if penInPrism(pEnd):
-            (xOut, yOut, zOut) = pEnd
-        else:
-            # Project xy onto rectangle:
-            (xOut, yOut, zOut) = boundByRectangle(pEnd)
-            # Deal with z issues:
-            if zPenEnd < Z_PAPER:
-                zOut = Z_PAPER + PEN_DIST
-            if zEnd > Z_MAX:
-                zOut = Z_MAX
-    else:
+    if not penPointValid(pStart):
     # This should never be entered, because pStart should always be valid. If
     # it isn't, send the point to home.
-        (xOut, yOut, zOut) = HOME
-        
+        return HOME
+
+    if penPointValid(pEnd):
+        (xOut, yOut, zOut) = pEnd
+    else:
+        (xOut, yOut, zOut) = projectToWorkspace(pEnd)
+
+    if not inRectangle(pStart):
+        if zOut - PEN_DIST < Z_CLAMP:
+            zOut = Z_CLAMP + PEN_DIST
+    elif pStart[2] - PEN_DIST < Z_CLAMP:
+        (xOut, yOut, zOut) = boundByRectangle((xOut, yOut, zOut))
+
     return (xOut, yOut, zOut)
                            
                            
+def segmentValid(pStart, pEnd):
+    """
+    Returns True if the pen stays within the workspace along the whole straight
+    move between the valid points 'pStart' and 'pEnd'. The part of the move 
+    above the clamps lies in the cylinder; the part below must start and end 
+    inside the paper rectangle.
+    """
+    (xStart, yStart, zStart) = pStart
+    (xEnd, yEnd, zEnd) = pEnd
+    zClampEnd = Z_CLAMP + PEN_DIST # Endpoint height at which pen hits clamps.
+    if (zStart >= zClampEnd) == (zEnd >= zClampEnd):
+        return True
+    # Point where the move crosses the clamp height.
+    t = (zClampEnd - zStart) / float(zEnd - zStart)
+    return inRectangle((xStart + t * (xEnd - xStart), 
+                        yStart + t * (yEnd - yStart), zClampEnd))
+
+def splitPath(path):
+    """
+    Returns a copy of the list 'path' of points (x, y, z), projecting invalid
+    points onto the workspace and splitting moves that cut through the clamps: 
+    the pen first rises to the clamp height, crosses over, and then drops down.
+    """
+    out = []
+    zClampEnd = Z_CLAMP + PEN_DIST
+    previous = None
+    for p in path:
+        if not penPointValid(p):
+            p = projectToWorkspace(p)
+        if previous is not None and not segmentValid(previous, p):
+            if previous[2] < zClampEnd:
+                out.append((previous[0], previous[1], zClampEnd))
+            if p[2] < zClampEnd:
+                out.append((p[0], p[1], zClampEnd))
+        out.append(p)
+        previous = p
+    return out
+                           
+                           
 if __name__ == "__main__":
     pStart = (0, 0, -12)
     pEnd = (0, 0, -4.25196)